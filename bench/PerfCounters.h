@@ -0,0 +1,168 @@
+#pragma once
+
+// System headers
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <linux/perf_event.h>
+#include <optional>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace ReactorAsterix::Bench {
+
+/**
+ * @brief The hardware events counted around each benchmark.
+ */
+enum class PerfEvent : size_t {
+    CYCLES = 0,
+    INSTRUCTIONS,
+    BRANCH_MISSES,
+    L1D_READ_MISSES,
+    LLC_MISSES,
+    COUNT
+};
+
+/**
+ * @brief Counter values of one measurement; an event the kernel or the CPU
+ * does not provide stays empty.
+ */
+struct PerfSample {
+    std::array<std::optional<uint64_t>, static_cast<size_t>(PerfEvent::COUNT)> values{};
+    uint64_t wallNanos{0};
+
+    [[nodiscard]] const std::optional<uint64_t>& operator[](PerfEvent event) const noexcept {
+        return values[static_cast<size_t>(event)];
+    }
+};
+
+/**
+ * @class PerfCounters
+ * @brief One perf_event_open group counting user-space cycles, instructions,
+ * branch misses, L1D read misses and LLC misses of the calling thread.
+ *
+ * All events are read at once (PERF_FORMAT_GROUP) and scaled by
+ * time_enabled / time_running when the PMU had to multiplex them. Events
+ * that fail to open (no PMU in a VM, perf_event_paranoid, ...) are simply
+ * left out; wall time is always measured.
+ */
+class PerfCounters {
+    public:
+        PerfCounters() {
+            for (size_t i = 0; i < fds.size(); ++i) {
+                const int fd = open(static_cast<PerfEvent>(i), leader);
+                if (fd < 0) {
+                    if (openError == 0) openError = errno;
+                    continue;
+                }
+                if (leader < 0) leader = fd;
+                fds[i] = fd;
+            }
+        }
+
+        ~PerfCounters() {
+            for (int fd : fds) {
+                if (fd >= 0) ::close(fd);
+            }
+        }
+
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        /**
+         * @brief True when at least one hardware event is counted.
+         */
+        [[nodiscard]] bool available() const noexcept { return leader >= 0; }
+
+        /**
+         * @brief errno of the first event that could not be opened, 0 if none.
+         */
+        [[nodiscard]] int error() const noexcept { return openError; }
+
+        void start() noexcept {
+            if (leader >= 0) {
+                ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+                ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+            }
+            startNanos = nowNanos();
+        }
+
+        [[nodiscard]] PerfSample stop() noexcept {
+            PerfSample sample;
+            sample.wallNanos = nowNanos() - startNanos;
+            if (leader < 0) return sample;
+
+            ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+            // { nr, time_enabled, time_running, value[nr] }
+            std::array<uint64_t, 3 + static_cast<size_t>(PerfEvent::COUNT)> buffer{};
+            const ssize_t got = ::read(leader, buffer.data(), sizeof(buffer));
+            if (got < static_cast<ssize_t>(3 * sizeof(uint64_t)) || buffer[2] == 0) return sample;
+
+            const double scale = static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]);
+            size_t slot = 3;
+            for (size_t i = 0; i < fds.size() && slot < 3 + buffer[0]; ++i) {
+                if (fds[i] < 0) continue;
+                sample.values[i] = static_cast<uint64_t>(static_cast<double>(buffer[slot++]) * scale);
+            }
+            return sample;
+        }
+
+    private:
+        static int open(PerfEvent event, int groupFd) noexcept {
+            struct perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            // Only the leader starts disabled; members follow its state
+            if (groupFd < 0) attr.disabled = 1;
+
+            switch (event) {
+                case PerfEvent::CYCLES:
+                    attr.type = PERF_TYPE_HARDWARE;
+                    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                    break;
+                case PerfEvent::INSTRUCTIONS:
+                    attr.type = PERF_TYPE_HARDWARE;
+                    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+                    break;
+                case PerfEvent::BRANCH_MISSES:
+                    attr.type = PERF_TYPE_HARDWARE;
+                    attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+                    break;
+                case PerfEvent::L1D_READ_MISSES:
+                    attr.type = PERF_TYPE_HW_CACHE;
+                    attr.config = PERF_COUNT_HW_CACHE_L1D
+                                | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                    break;
+                case PerfEvent::LLC_MISSES:
+                    attr.type = PERF_TYPE_HARDWARE;
+                    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+                    break;
+                case PerfEvent::COUNT:
+                    return -1;
+            }
+
+            return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+        }
+
+        static uint64_t nowNanos() noexcept {
+            struct timespec ts{};
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            return static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ULL + static_cast<uint64_t>(ts.tv_nsec);
+        }
+
+        std::array<int, static_cast<size_t>(PerfEvent::COUNT)> fds{-1, -1, -1, -1, -1};
+        int leader{-1};
+        int openError{0};
+        uint64_t startNanos{0};
+};
+
+} // namespace ReactorAsterix::Bench
@@ -0,0 +1,436 @@
+// Decoder micro-benchmarks with hardware performance counters.
+//
+// Usage: asterix_bench [--records N] [--repeat R] [--filter NAME] [--json PATH]
+//                      [--corpus FILE]
+//
+// Each benchmark decodes N synthetic records R times; the best repetition
+// (fewest cycles, or shortest wall time without counters) is reported per
+// record as one JSON document, on stdout unless --json is given. Counters
+// the machine does not provide are reported as null.
+//
+// --corpus adds "replay_corpus": a recorded file (raw, FINAL or IOSS) loaded
+// in memory and decoded by CAT001 and CAT002 handlers, which is also the
+// training run of a PGO build (REACTORASTERIX_PGO=GENERATE).
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "PerfCounters.h"
+
+#include "ReactorAsterix/cat001/Asterix1Handler.h"
+#include "ReactorAsterix/cat002/Asterix2Handler.h"
+#include "ReactorAsterix/core/AsterixPacketHandler.h"
+#include "ReactorAsterix/core/IAsterixCategoryHandler.h"
+#include "ReactorAsterix/core/SourceStateManager.h"
+#ifdef REACTORASTERIX_BENCH_RECORDING
+#include "ReactorAsterix/recording/AsterixFileReader.h"
+#endif
+
+using namespace ReactorAsterix;
+using namespace ReactorAsterix::Bench;
+
+namespace {
+
+struct Options {
+    size_t records{100000};
+    size_t repeat{5};
+    std::string filter;
+    std::string jsonPath;
+    std::string corpusPath;
+};
+
+struct Record {
+    std::string_view fspec;
+    std::string_view payload;
+};
+
+struct Result {
+    std::string name;
+    size_t records{0};
+    PerfSample sample;
+};
+
+// Synthetic record corpus: 'records' concatenated records plus the views
+// splitting each one in FSPEC and payload
+struct Corpus {
+    std::string bytes;
+    std::vector<Record> records;
+};
+
+// CAT001 plots: SAC/SIC, descriptor, polar position, Mode 3/A, Mode C and
+// truncated time, half of them with the extended FSPEC carrying I001/131
+Corpus makeCat001(size_t count) {
+    Corpus corpus;
+    std::vector<size_t> fspecSizes;
+    for (size_t i = 0; i < count; ++i) {
+        const auto az = static_cast<char>(i & 0xFF);
+        if (i % 2 == 0) {
+            corpus.bytes += std::string("\xFA", 1);
+            fspecSizes.push_back(1);
+        } else {
+            corpus.bytes += std::string("\xFB\x20", 2);
+            fspecSizes.push_back(2);
+        }
+        corpus.bytes += std::string("\x01\x02" "\x20" "\x00\x80", 5);
+        corpus.bytes += az;
+        corpus.bytes += std::string("\x00" "\x0F\xFF" "\x00\x64" "\x12\x34", 7);
+        if (i % 2 != 0) corpus.bytes += std::string("\x40", 1);
+    }
+
+    size_t offset = 0;
+    const std::string_view view(corpus.bytes);
+    for (size_t i = 0; i < count; ++i) {
+        const size_t payloadSize = fspecSizes[i] == 1 ? 13 : 14;
+        corpus.records.push_back({view.substr(offset, fspecSizes[i]),
+                                  view.substr(offset + fspecSizes[i], payloadSize)});
+        offset += fspecSizes[i] + payloadSize;
+    }
+    return corpus;
+}
+
+// CAT002 service messages: sector crossings, with one north marker carrying
+// the antenna rotation period every 32 messages
+Corpus makeCat002(size_t count) {
+    Corpus corpus;
+    std::vector<size_t> payloadSizes;
+    for (size_t i = 0; i < count; ++i) {
+        const auto tod = static_cast<char>(i & 0xFF);
+        if (i % 32 == 0) {
+            // 010, 000 (north marker), 030, 041
+            corpus.bytes += std::string("\xD8" "\x01\x02" "\x01" "\x00\x10", 6);
+            corpus.bytes += tod;
+            corpus.bytes += std::string("\x02\x00", 2);
+            payloadSizes.push_back(8);
+        } else {
+            // 010, 000 (sector crossing), 020, 030
+            corpus.bytes += std::string("\xF0" "\x01\x02" "\x02", 4);
+            corpus.bytes += static_cast<char>((i * 8) & 0xFF);
+            corpus.bytes += std::string("\x00\x10", 2);
+            corpus.bytes += tod;
+            payloadSizes.push_back(7);
+        }
+    }
+
+    size_t offset = 0;
+    const std::string_view view(corpus.bytes);
+    for (size_t i = 0; i < count; ++i) {
+        corpus.records.push_back({view.substr(offset, 1), view.substr(offset + 1, payloadSizes[i])});
+        offset += 1 + payloadSizes[i];
+    }
+    return corpus;
+}
+
+/**
+ * Category handler consuming a fixed payload size without decoding, so that
+ * the packet benchmark only measures block framing and FSPEC parsing.
+ */
+class NullCategoryHandler final : public IAsterixCategoryHandler {
+    public:
+        explicit NullCategoryHandler(size_t _payloadSize) : payloadSize(_payloadSize) {}
+
+        void setStats([[maybe_unused]] AsterixStats& stats) override {}
+
+        size_t processDataRecord([[maybe_unused]] std::string_view fspec, std::string_view payload) override {
+            return payload.size() < payloadSize ? 0 : payloadSize;
+        }
+
+    private:
+        size_t payloadSize;
+};
+
+constexpr size_t MAX_BLOCK_SIZE = 1400;
+
+// Groups concatenated records into data blocks of category 'cat', one
+// datagram per block
+std::vector<std::string> makeBlocks(uint8_t cat, const std::vector<std::string>& records) {
+    std::vector<std::string> blocks;
+    std::string block;
+    auto flush = [&]() {
+        if (block.empty()) return;
+        const size_t length = block.size() + 3;
+        blocks.push_back(std::string{static_cast<char>(cat),
+                                     static_cast<char>(length >> 8),
+                                     static_cast<char>(length & 0xFF)} + block);
+        block.clear();
+    };
+    for (const auto& record : records) {
+        if (block.size() + record.size() + 3 > MAX_BLOCK_SIZE) flush();
+        block += record;
+    }
+    flush();
+    return blocks;
+}
+
+// Records with 1 to 3 FSPEC bytes followed by an 8-byte payload
+std::vector<std::string> makeFspecRecords(size_t count) {
+    static const std::string_view FSPECS[] = {
+        {"\xF8", 1}, {"\xFB\x20", 2}, {"\xA1\x81\x40", 3}, {"\xE0", 1}, {"\x81\x01\x80", 3}
+    };
+    std::vector<std::string> records;
+    records.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        records.push_back(std::string(FSPECS[i % std::size(FSPECS)]) + std::string(8, '\x55'));
+    }
+    return records;
+}
+
+std::vector<std::string> splitRecords(const Corpus& corpus) {
+    std::vector<std::string> records;
+    records.reserve(corpus.records.size());
+    for (const auto& record : corpus.records) {
+        records.push_back(std::string(record.fspec) + std::string(record.payload));
+    }
+    return records;
+}
+
+// Runs 'body' 'repeat' times and keeps the best repetition
+Result measure(const std::string& name, size_t records, size_t repeat, const std::function<void()>& body) {
+    PerfCounters counters;
+    Result best{name, records, {}};
+    bool first = true;
+
+    body(); // Warm caches and branch predictors
+    for (size_t r = 0; r < repeat; ++r) {
+        counters.start();
+        body();
+        const PerfSample sample = counters.stop();
+
+        const auto& cycles = sample[PerfEvent::CYCLES];
+        const auto& bestCycles = best.sample[PerfEvent::CYCLES];
+        const bool better = cycles && bestCycles ? *cycles < *bestCycles
+                                                 : sample.wallNanos < best.sample.wallNanos;
+        if (first || better) {
+            best.sample = sample;
+            first = false;
+        }
+    }
+    return best;
+}
+
+size_t decodeRecords(IAsterixCategoryHandler& handler, const std::vector<Record>& records) {
+    size_t consumed = 0;
+    for (const auto& record : records) {
+        consumed += handler.processDataRecord(record.fspec, record.payload);
+    }
+    return consumed;
+}
+
+// Total payload bytes, which a handler decoding every record consumes
+size_t payloadBytes(const std::vector<Record>& records) {
+    size_t bytes = 0;
+    for (const auto& record : records) bytes += record.payload.size();
+    return bytes;
+}
+
+void handleBlocks(AsterixPacketHandler& packetHandler, const std::vector<std::string>& blocks) {
+    const struct timespec ts{};
+    for (const auto& block : blocks) {
+        packetHandler.handlePacket(reinterpret_cast<const uint8_t*>(block.data()), block.size(), ts);
+    }
+}
+
+#ifdef REACTORASTERIX_BENCH_RECORDING
+// Loads every datagram of a recording, so that file I/O stays out of the
+// measurement
+int loadCorpus(const std::string& path, std::vector<std::string>& blocks) {
+    Recording::AsterixFileReader reader;
+    if (const int error = reader.open(path)) return error;
+
+    AsterixDatagram datagram{};
+    int read;
+    while ((read = reader.next(datagram)) > 0) {
+        blocks.emplace_back(reinterpret_cast<const char*>(datagram.data), datagram.size);
+    }
+    return read < 0 ? -read : 0;
+}
+
+void registerDecoders(AsterixPacketHandler& packetHandler) {
+    auto manager = std::make_shared<SourceStateManager>();
+    packetHandler.registerCategoryHandler(1, std::make_unique<Asterix1Handler>(manager));
+    packetHandler.registerCategoryHandler(2, std::make_unique<Asterix2Handler>(manager));
+}
+#endif
+
+void writePerRecord(FILE* out, const char* key, const std::optional<uint64_t>& value, size_t records) {
+    if (value) {
+        std::fprintf(out, ",\"%s\":%.4f", key, static_cast<double>(*value) / static_cast<double>(records));
+    } else {
+        std::fprintf(out, ",\"%s\":null", key);
+    }
+}
+
+void writeJson(FILE* out, const std::vector<Result>& results, const PerfCounters& probe) {
+    std::fprintf(out, "{\"perf_available\":%s", probe.available() ? "true" : "false");
+    if (probe.error() != 0) std::fprintf(out, ",\"perf_error\":\"%s\"", std::strerror(probe.error()));
+    std::fprintf(out, ",\"benchmarks\":[");
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& result = results[i];
+        const PerfSample& sample = result.sample;
+        std::fprintf(out, "%s\n  {\"name\":\"%s\",\"records\":%zu,\"ns_per_record\":%.3f",
+                     i ? "," : "", result.name.c_str(), result.records,
+                     static_cast<double>(sample.wallNanos) / static_cast<double>(result.records));
+        writePerRecord(out, "cycles_per_record", sample[PerfEvent::CYCLES], result.records);
+        writePerRecord(out, "instructions_per_record", sample[PerfEvent::INSTRUCTIONS], result.records);
+
+        const auto& cycles = sample[PerfEvent::CYCLES];
+        const auto& instructions = sample[PerfEvent::INSTRUCTIONS];
+        if (cycles && instructions && *cycles > 0) {
+            std::fprintf(out, ",\"ipc\":%.3f", static_cast<double>(*instructions) / static_cast<double>(*cycles));
+        } else {
+            std::fprintf(out, ",\"ipc\":null");
+        }
+
+        writePerRecord(out, "branch_misses_per_record", sample[PerfEvent::BRANCH_MISSES], result.records);
+        writePerRecord(out, "l1d_misses_per_record", sample[PerfEvent::L1D_READ_MISSES], result.records);
+        writePerRecord(out, "llc_misses_per_record", sample[PerfEvent::LLC_MISSES], result.records);
+        std::fprintf(out, "}");
+    }
+    std::fprintf(out, "\n]}\n");
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg(argv[i]);
+        if (i + 1 >= argc) return false;
+        const char* value = argv[++i];
+        if (arg == "--records") {
+            options.records = std::strtoul(value, nullptr, 10);
+        } else if (arg == "--repeat") {
+            options.repeat = std::strtoul(value, nullptr, 10);
+        } else if (arg == "--filter") {
+            options.filter = value;
+        } else if (arg == "--json") {
+            options.jsonPath = value;
+        } else if (arg == "--corpus") {
+            options.corpusPath = value;
+        } else {
+            return false;
+        }
+    }
+    return options.records > 0 && options.repeat > 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "usage: %s [--records N] [--repeat R] [--filter NAME] [--json PATH] [--corpus FILE]\n",
+                     argv[0]);
+        return 2;
+    }
+
+    auto selected = [&](const std::string& name) {
+        return options.filter.empty() || name.find(options.filter) != std::string::npos;
+    };
+
+    std::vector<Result> results;
+    const Corpus cat001 = makeCat001(options.records);
+    const Corpus cat002 = makeCat002(options.records);
+
+    // Category handlers alone, on records already split by the dispatcher
+    if (selected("cat001_records")) {
+        Asterix1Handler handler(std::make_shared<SourceStateManager>());
+        AsterixStats stats;
+        handler.setStats(stats);
+        if (decodeRecords(handler, cat001.records) != payloadBytes(cat001.records)) {
+            std::fprintf(stderr, "cat001_records: synthetic records do not decode\n");
+            return 1;
+        }
+        results.push_back(measure("cat001_records", options.records, options.repeat,
+                                  [&]() { (void)decodeRecords(handler, cat001.records); }));
+    }
+
+    if (selected("cat002_records")) {
+        Asterix2Handler handler(std::make_shared<SourceStateManager>());
+        AsterixStats stats;
+        handler.setStats(stats);
+        if (decodeRecords(handler, cat002.records) != payloadBytes(cat002.records)) {
+            std::fprintf(stderr, "cat002_records: synthetic records do not decode\n");
+            return 1;
+        }
+        results.push_back(measure("cat002_records", options.records, options.repeat,
+                                  [&]() { (void)decodeRecords(handler, cat002.records); }));
+    }
+
+    // Block framing and FSPEC parsing of AsterixPacketHandler, no decoding
+    if (selected("dispatch_fspec")) {
+        AsterixPacketHandler packetHandler;
+        packetHandler.registerCategoryHandler(48, std::make_unique<NullCategoryHandler>(8));
+        const auto blocks = makeBlocks(48, makeFspecRecords(options.records));
+        results.push_back(measure("dispatch_fspec", options.records, options.repeat,
+                                  [&]() { handleBlocks(packetHandler, blocks); }));
+    }
+
+    // End to end: datagrams in, decoded CAT001 reports out
+    if (selected("packet_cat001")) {
+        AsterixPacketHandler packetHandler;
+        packetHandler.registerCategoryHandler(1, std::make_unique<Asterix1Handler>(std::make_shared<SourceStateManager>()));
+        const auto blocks = makeBlocks(1, splitRecords(cat001));
+        results.push_back(measure("packet_cat001", options.records, options.repeat,
+                                  [&]() { handleBlocks(packetHandler, blocks); }));
+    }
+
+    // Same datagrams in strict validation mode, errors drained as they come
+    if (selected("packet_cat001_validated")) {
+        AsterixPacketHandler packetHandler;
+        packetHandler.registerCategoryHandler(1, std::make_unique<Asterix1Handler>(std::make_shared<SourceStateManager>()));
+        packetHandler.enableValidation();
+        const auto blocks = makeBlocks(1, splitRecords(cat001));
+        results.push_back(measure("packet_cat001_validated", options.records, options.repeat, [&]() {
+            handleBlocks(packetHandler, blocks);
+            ValidationError error;
+            while (packetHandler.getValidationLog()->tryPop(error)) {}
+        }));
+    }
+
+    if (!options.corpusPath.empty() && selected("replay_corpus")) {
+#ifdef REACTORASTERIX_BENCH_RECORDING
+        std::vector<std::string> blocks;
+        if (const int error = loadCorpus(options.corpusPath, blocks)) {
+            std::fprintf(stderr, "%s: %s\n", options.corpusPath.c_str(), std::strerror(error));
+            return 1;
+        }
+
+        // Records are counted by a first pass; later passes see the same
+        // traffic with warm source states
+        AsterixPacketHandler packetHandler;
+        registerDecoders(packetHandler);
+        handleBlocks(packetHandler, blocks);
+        const size_t records = static_cast<size_t>(packetHandler.getCategorySnapshot(1).records +
+                                                   packetHandler.getCategorySnapshot(2).records);
+        if (records == 0) {
+            std::fprintf(stderr, "%s: no CAT001/CAT002 record\n", options.corpusPath.c_str());
+            return 1;
+        }
+        results.push_back(measure("replay_corpus", records, options.repeat,
+                                  [&]() { handleBlocks(packetHandler, blocks); }));
+#else
+        std::fprintf(stderr, "--corpus needs the recording module (REACTORASTERIX_RECORDING)\n");
+        return 2;
+#endif
+    }
+
+    FILE* out = stdout;
+    if (!options.jsonPath.empty()) {
+        out = std::fopen(options.jsonPath.c_str(), "w");
+        if (out == nullptr) {
+            std::fprintf(stderr, "%s: %s\n", options.jsonPath.c_str(), std::strerror(errno));
+            return 1;
+        }
+    }
+
+    const PerfCounters probe;
+    writeJson(out, results, probe);
+    if (out != stdout) std::fclose(out);
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <cstdint>
+#include <type_traits>
+
+namespace ReactorAsterix {
+
+class Asterix1Report;
+
+/**
+ * @struct Asterix1CompactReport
+ * @brief Trivially copyable, 20-byte form of an Asterix1Report.
+ *
+ * Values are kept in their on-the-wire fixed-point units and optional items
+ * are flagged by presence bits, so the struct can be memcpy'd into queues,
+ * recordings or batches. Float accessors convert to physical units.
+ */
+struct Asterix1CompactReport {
+    enum Flags : uint8_t {
+        HAS_POLAR       = 0x01, // I001/040
+        HAS_MODE3A      = 0x02, // I001/070
+        HAS_MODEC       = 0x04, // I001/090
+        HAS_LSP_CLOCK   = 0x08, // I001/141
+        MODEC_VALIDATED = 0x10,
+        MODEC_GARBLED   = 0x20,
+        SPI             = 0x40
+    };
+
+    // Mode 3/A word: 12-bit code plus the flags below
+    static constexpr uint16_t MODE3A_CODE_MASK = 0x0FFF;
+    static constexpr uint16_t MODE3A_VALIDATED = 0x8000;
+    static constexpr uint16_t MODE3A_GARBLED   = 0x4000;
+    static constexpr uint16_t MODE3A_LOCAL     = 0x2000;
+
+    uint32_t tod;        // Full TOD, 1/128 s
+    uint16_t range;      // 1/128 NM
+    uint16_t azimuth;    // 360/2^16 deg
+    uint16_t mode3A;     // Code and MODE3A_* flags
+    int16_t  modeC;      // 1/4 FL
+    uint16_t todLSP;     // I001/141 as received
+    uint8_t  sac;
+    uint8_t  sic;
+    uint8_t  descriptor; // SSR/PSR in bits 0-1, DS1/DS2 in bits 2-3
+    uint8_t  flags;      // Flags
+
+    /**
+     * @brief Packs a decoded report into its compact form.
+     */
+    [[nodiscard]] static Asterix1CompactReport pack(const Asterix1Report& report) noexcept;
+
+    /**
+     * @brief Restores the full report (physical units, std::optional items).
+     */
+    void unpack(Asterix1Report& report) const noexcept;
+
+    [[nodiscard]] bool has(Flags f) const noexcept { return flags & f; }
+
+    [[nodiscard]] float rangeMeters() const noexcept {
+        return static_cast<float>(range) * (1852.0f / 128.0f);
+    }
+
+    [[nodiscard]] float azimuthRadians() const noexcept {
+        return static_cast<float>(azimuth) * 9.587379924e-05f; // 2*pi / 65536
+    }
+
+    [[nodiscard]] float heightMeters() const noexcept {
+        return static_cast<float>(modeC) * (25.0f * 0.3048f);
+    }
+
+    [[nodiscard]] float todSeconds() const noexcept {
+        return static_cast<float>(tod) / 128.0f;
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<Asterix1CompactReport>);
+static_assert(sizeof(Asterix1CompactReport) == 20);
+
+} // namespace ReactorAsterix
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
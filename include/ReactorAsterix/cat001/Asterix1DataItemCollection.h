@@ -77,6 +77,11 @@ class I001_020_Handler final : public AsterixDataItemHandlerExtendedLength<Aster
          * @param data The raw data buffer.
          */
         void decode(Asterix1Report& context, std::string_view data) const override;
+
+        /**
+         * @brief Strict validation: reserved bits and a third octet.
+         */
+        void validate(std::string_view data, ValidationSink& sink) const override;
 };
 
 /**
@@ -115,6 +120,11 @@ class I001_070_Handler final : public AsterixDataItemHandlerFixedLength<Asterix1
          * @param data The raw data buffer.
          */
         void decode(Asterix1Report& context, std::string_view data) const override;
+
+        /**
+         * @brief Strict validation: the spare bit.
+         */
+        void validate(std::string_view data, ValidationSink& sink) const override;
 };
 
 /**
@@ -134,6 +144,11 @@ class I001_090_Handler final : public AsterixDataItemHandlerFixedLength<Asterix1
          * @param data The raw data buffer.
          */
         void decode(Asterix1Report& context, std::string_view data) const override;
+
+        /**
+         * @brief Strict validation: the flight level range (-12 to 1270 FL).
+         */
+        void validate(std::string_view data, ValidationSink& sink) const override;
 };
 
 /**
@@ -29,6 +29,7 @@
 
 // Library headers
 #include <ReactorAsterix/cat001/IAsterix1Listener.h>
+#include <ReactorAsterix/core/ReportPool.h>
 #include <ReactorAsterix/core/SourceStateManager.h>
 
 namespace ReactorAsterix {
@@ -66,6 +67,16 @@ class Asterix1Handler final : public AsterixCategoryHandler<Asterix1Report> {
             }
         }
 
+        /**
+         * @brief Opt-in: decode into reports taken from a per-handler pool.
+         *
+         * Listeners receive them through IAsterix1Listener::onPooledReport()
+         * and may keep the handle past the callback without copying.
+         *
+         * @param chunkSize Number of reports allocated at a time.
+         */
+        void enableReportPool(size_t chunkSize = 256);
+
         /**
          * @brief Main function for processing a single record.
          *
@@ -89,18 +100,12 @@ class Asterix1Handler final : public AsterixCategoryHandler<Asterix1Report> {
          */
         void registerHandlers() override;
 
-    private:
         /**
-         * @brief Pure logic helper: Expands 16-bit truncated TOD.
-         * Static because it depends only on inputs, not object state.
+         * @brief Strict validation: a sole primary plot has no Mode-3/A nor Mode-C.
          */
-        static uint32_t expandTruncatedTime(uint16_t truncated, uint32_t reference) noexcept;
-
-        /**
-         * @brief Pure logic helper: Gets system time in ASTERIX units.
-         */
-        static uint32_t calculateCurrentTod() noexcept;
+        void validateReport(const Asterix1Report& report, ValidationSink& sink) const override;
 
+    private:
         // Supports multiple sinks (Logger, Tracker, Display)
         std::vector<std::weak_ptr<IAsterix1Listener>> listeners;
 
@@ -108,6 +113,9 @@ class Asterix1Handler final : public AsterixCategoryHandler<Asterix1Report> {
         mutable std::shared_mutex listenerMutex;
 
         std::shared_ptr<SourceStateManager> sourceStateManager;
+
+        // Null unless enableReportPool() was called
+        ReportPool<Asterix1Report>::Owner reportPool;
 };
 
 } // namespace ReactorAsterix
@@ -82,6 +82,9 @@ class Asterix1Report final : public AsterixMessage {
 
         bool spi{false};
 
+        // I001/040 present
+        bool hasPolarPosition{false};
+
         // Time Data
         bool hasLspClock{false};
 
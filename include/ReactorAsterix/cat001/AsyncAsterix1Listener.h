@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Inherits from
+#include <ReactorAsterix/cat001/IAsterix1Listener.h>
+
+// System headers
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// Library headers
+#include <ReactorAsterix/cat001/Asterix1CompactReport.h>
+#include <ReactorAsterix/core/SpscRing.h>
+
+namespace ReactorAsterix {
+
+/**
+ * @class AsyncAsterix1Listener
+ * @brief Decouples a slow listener from the decoding thread.
+ *
+ * Registered on an Asterix1Handler like any listener, it only packs the
+ * report into an Asterix1CompactReport and enqueues it. A dedicated
+ * consumer thread restores the report and calls the wrapped listener.
+ *
+ * The decoding thread is the single producer: register one adapter per
+ * Asterix1Handler.
+ */
+class AsyncAsterix1Listener final : public IAsterix1Listener {
+    public:
+        /**
+         * @brief What the producer does when the ring is full.
+         */
+        enum class OverflowPolicy : uint8_t {
+            DROP_OLDEST, // Discard the oldest queued report
+            DROP_NEWEST, // Discard the incoming report
+            BLOCK        // Wait for the consumer (back-pressure on decoding)
+        };
+
+        /**
+         * @brief A copyable snapshot of the adapter counters.
+         */
+        struct Counters {
+            uint64_t enqueued{0};
+            uint64_t delivered{0};
+            uint64_t droppedOldest{0};
+            uint64_t droppedNewest{0};
+            uint64_t blocked{0}; // Number of enqueues that had to wait
+        };
+
+        /**
+         * @brief Constructor. Starts the consumer thread.
+         * @param target The listener called from the consumer thread.
+         * @param capacity Ring size, rounded up to a power of two.
+         * @param policy Overflow policy.
+         */
+        explicit AsyncAsterix1Listener(std::shared_ptr<IAsterix1Listener> target,
+                                       size_t capacity = 4096,
+                                       OverflowPolicy policy = OverflowPolicy::DROP_NEWEST);
+
+        /**
+         * @brief Delivers what is still queued, then joins the consumer thread.
+         */
+        ~AsyncAsterix1Listener() override;
+
+        AsyncAsterix1Listener(const AsyncAsterix1Listener&) = delete;
+        AsyncAsterix1Listener& operator=(const AsyncAsterix1Listener&) = delete;
+
+        /**
+         * @brief Producer side: enqueues the report according to the policy.
+         */
+        void onReportDecoded(const Asterix1Report& report) override;
+
+        [[nodiscard]] Counters getCounters() const noexcept;
+
+    private:
+        void run();
+
+        void wakeConsumer();
+
+        std::shared_ptr<IAsterix1Listener> target;
+        const OverflowPolicy policy;
+
+        SpscRing<Asterix1CompactReport> ring;
+
+        // Producer counters
+        std::atomic<uint64_t> enqueued{0};
+        std::atomic<uint64_t> droppedOldest{0};
+        std::atomic<uint64_t> droppedNewest{0};
+        std::atomic<uint64_t> blocked{0};
+
+        // Consumer counter
+        std::atomic<uint64_t> delivered{0};
+
+        // Parking of the idle consumer
+        std::mutex parkMutex;
+        std::condition_variable parkCv;
+        std::atomic<bool> parked{false};
+
+        std::atomic<bool> running{true};
+        std::thread consumer;
+};
+
+} // namespace ReactorAsterix
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -17,9 +17,11 @@
 
 #pragma once
 
-namespace ReactorAsterix {
+// Library headers
+#include <ReactorAsterix/cat001/Asterix1Report.h>
+#include <ReactorAsterix/core/ReportPool.h>
 
-class Asterix1Report;
+namespace ReactorAsterix {
 
 /**
  * @class IAsterix1Listener
@@ -34,6 +36,14 @@ class IAsterix1Listener {
          * Uses a virtual call which is faster than std::function for shared libraries.
          */
         virtual void onReportDecoded(const Asterix1Report& report) = 0;
+
+        /**
+         * @brief Called instead of onReportDecoded() when the handler runs with
+         * a report pool. Copy the handle to keep the report after returning.
+         */
+        virtual void onPooledReport(const PooledReport<Asterix1Report>& report) {
+            onReportDecoded(*report);
+        }
 };
 
 } // namespace ReactorAsterix
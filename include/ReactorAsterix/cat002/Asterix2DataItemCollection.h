@@ -73,6 +73,11 @@ class I002_000_Handler final: public AsterixDataItemHandlerFixedLength<Asterix2R
             mandatory = true;
             name      = "I002/000, Message Type";
         }
+        void decode(Asterix2Report& context, std::string_view data) const override;
+        /**
+         * @brief Strict validation: the message type.
+         */
+        void validate(std::string_view data, ValidationSink& sink) const override;
 };
 
 /**
@@ -88,6 +93,7 @@ class I002_020_Handler final : public AsterixDataItemHandlerFixedLength<Asterix2
             mandatory = false;
             name      = "I002/020, Sector Number";
         }
+        void decode(Asterix2Report& context, std::string_view data) const override;
 };
 
 /**
@@ -104,6 +110,10 @@ class I002_030_Handler : public AsterixDataItemHandlerFixedLength<Asterix2Report
             name      = "I002/030, Time of Day";
         }
         void decode(Asterix2Report& context,  std::string_view data) const override;
+        /**
+         * @brief Strict validation: the time of day range (below 24 h).
+         */
+        void validate(std::string_view data, ValidationSink& sink) const override;
 };
 
 /**
@@ -89,6 +89,11 @@ class Asterix2Handler final : public AsterixCategoryHandler<Asterix2Report> {
          */
         void registerHandlers() override;
 
+        /**
+         * @brief Strict validation: a sector crossing carries its sector number.
+         */
+        void validateReport(const Asterix2Report& report, ValidationSink& sink) const override;
+
     private:
         // Supports multiple sinks (Logger, Tracker, Display)
         std::vector<std::weak_ptr<IAsterix2Listener>> listeners;
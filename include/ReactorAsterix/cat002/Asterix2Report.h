@@ -37,9 +37,41 @@ class Asterix2Report : public AsterixMessage {
         Asterix2Report() = default;
         ~Asterix2Report() override = default;
 
-      float antennaSpeed;
+        // I002/000 Message Type values
+        enum class MessageType : uint8_t {
+            UNKNOWN = 0,
+            NORTH_MARKER = 1,
+            SECTOR_CROSSING = 2,
+            SOUTH_MARKER = 3,
+            ACTIVATION_OF_BLIND_ZONE_FILTERING = 8,
+            STOP_OF_BLIND_ZONE_FILTERING = 9
+        };
+
+      float antennaSpeed{0.0f};
+
+      MessageType messageType{MessageType::UNKNOWN};
+
+      // I002/020: Azimuth of the sector (LSB = 360/256 deg)
+      uint8_t sectorNumber{0};
+      bool hasSectorNumber{false};
+
+      // I002/041: Raw value as transmitted (LSB = 1/128 s per revolution)
+      uint16_t antennaPeriod{0};
+      bool hasAntennaPeriod{false};
 
       void setAntennaSpeed(float speed) { antennaSpeed = speed; };
+
+      void setMessageType(uint8_t type) { messageType = static_cast<MessageType>(type); }
+
+      void setSectorNumber(uint8_t sector) {
+          sectorNumber = sector;
+          hasSectorNumber = true;
+      }
+
+      void setAntennaPeriod(uint16_t raw) {
+          antennaPeriod = raw;
+          hasAntennaPeriod = true;
+      }
 };
 
 } // namespace ReactorAsterix
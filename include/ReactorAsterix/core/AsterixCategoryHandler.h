@@ -23,12 +23,19 @@
 // System headers
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <memory>
+#include <utility>
 #include <vector>
 
 // Libray headers
 #include <ReactorAsterix/core/IAsterixDataItemHandler.h>
 #include <ReactorAsterix/core/AsterixDiagnostics.h>
+#include <ReactorAsterix/core/AsterixMessage.h>
+#include <ReactorAsterix/core/AsterixProbes.h>
+#include <ReactorAsterix/core/AsterixValidation.h>
+#include <ReactorAsterix/core/Fspec.h>
+#include <ReactorAsterix/core/TimeReference.h>
 
 namespace ReactorAsterix {
 
@@ -51,10 +58,69 @@ class AsterixCategoryHandler : public IAsterixCategoryHandler {
          */
         void setStats(AsterixStats& s) override;
 
+        /**
+         * @brief Links the time reference of the owning packet handler.
+         */
+        void setTimeReference(TimeReference& t) override { time_ptr = &t; }
+
+        /**
+         * @brief Links the latency histograms of the owning packet handler.
+         */
+        void setLatencyStats(AsterixLatencyStats* l) override { latency_ptr = l; }
+
+        /**
+         * @brief Links the per-category counters and the optional per-source table.
+         */
+        void setBreakdownStats(AsterixCategoryStats* c, AsterixSourceStats* s) override {
+            category_ptr = c;
+            sources_ptr = s;
+        }
+
+        /**
+         * @brief Links the log of strict validation mode (null: off).
+         */
+        void setValidationLog(AsterixValidationLog* v, uint8_t category) override {
+            validation_ptr = v;
+            validationCategory = category;
+        }
+
     protected:
-        // Pre-computed F-spec where bits are 1 if the item is mandatory
-        std::array<uint8_t, 20> mandatoryFspec{};
-        size_t mandatoryFspecSize = 0; // Tracks the highest byte index used
+        // FRNs of the mandatory items
+        Fspec::FrnMask mandatoryItems{};
+
+        // FRNs of the fixed-length items and their sizes
+        Fspec::FrnMask fixedItems{};
+        std::array<uint8_t, 128> fixedSizes{}; // Indexed by FRN - 1
+
+        /**
+         * @brief Resolved decoding of one FSPEC pattern: the handlers of its
+         * items in payload order, their fixed sizes (0 when variable) and,
+         * when every item is fixed, their offsets and the total size.
+         */
+        struct DecodePlan {
+            static constexpr size_t MAX_ITEMS = 16;
+
+            // Key: the FSPEC bytes, little-endian, and their count (0: empty slot)
+            uint64_t keyLow{0};
+            uint64_t keyHigh{0};
+            uint8_t keySize{0};
+
+            uint8_t itemCount{0};
+            bool allFixed{false};
+            uint16_t totalSize{0};
+            std::array<uint8_t, MAX_ITEMS> frns{};
+            std::array<uint8_t, MAX_ITEMS> sizes{};
+            std::array<uint16_t, MAX_ITEMS> offsets{};
+            std::array<IAsterixDataItemHandler<T>*, MAX_ITEMS> items{};
+        };
+
+        /**
+         * @brief Direct-mapped plan cache: a radar emits a handful of FSPEC
+         * patterns, and a repeated one skips the presence mask, the
+         * mandatory and FX checks and the per-item getSize() calls.
+         */
+        static constexpr size_t PLAN_CACHE_SIZE = 16;
+        std::array<DecodePlan, PLAN_CACHE_SIZE> plans{};
 
         /**
          * @brief Registers the specific data item handlers for the ASTERIX category.
@@ -77,15 +143,22 @@ class AsterixCategoryHandler : public IAsterixCategoryHandler {
                 h->setStats(*this->stats_ptr);
             }
 
+            // Plans hold item handlers: rebuild them on demand
+            plans.fill(DecodePlan{});
+
+            // Describe the new item in the FRN masks, dropping the old one
+            const Fspec::FrnMask bit = Fspec::FrnMask::of(frn);
+            mandatoryItems &= ~bit;
+            fixedItems &= ~bit;
+            fixedSizes[frn - 1] = 0;
+
             if (h->isMandatory()) {
-                // Determine which byte and bit in the F-spec this FRN corresponds to
-                const size_t uFrn = static_cast<size_t>(frn);
-                size_t byteIdx = (uFrn - 1) / 7;
-                size_t bitIdx  = 7 - ((uFrn - 1) % 7); // Bits 7 to 1
-
-                // Set the bit in the mandatory mask corresponding to this FRN
-                mandatoryFspec[byteIdx] |= static_cast<uint8_t>(1 << bitIdx);
-                mandatoryFspecSize = std::max(mandatoryFspecSize, byteIdx + 1);
+                mandatoryItems |= bit;
+            }
+
+            if (const size_t fixedSize = h->getFixedSize(); fixedSize > 0 && fixedSize < 256) {
+                fixedItems |= bit;
+                fixedSizes[frn - 1] = static_cast<uint8_t>(fixedSize);
             }
 
             // RESET LOGIC: Check if an FRN is already occupied
@@ -113,6 +186,66 @@ class AsterixCategoryHandler : public IAsterixCategoryHandler {
          */
         AsterixStats* stats_ptr = nullptr;
 
+        /**
+         * @brief Pointer to the packet-scoped time reference (may be null
+         * when the handler is used outside an AsterixPacketHandler).
+         */
+        TimeReference* time_ptr = nullptr;
+
+        /**
+         * @brief Pointer to the latency histograms, null unless enabled.
+         */
+        AsterixLatencyStats* latency_ptr = nullptr;
+
+        /**
+         * @brief Counters of this category and per-source table (may be null).
+         */
+        AsterixCategoryStats* category_ptr = nullptr;
+        AsterixSourceStats* sources_ptr = nullptr;
+
+        /**
+         * @brief Log of strict validation mode, null unless enabled.
+         */
+        AsterixValidationLog* validation_ptr = nullptr;
+        uint8_t validationCategory{0};
+
+        /**
+         * @brief Category rules of strict validation mode, checked on the
+         * decoded record; the default checks nothing.
+         */
+        virtual void validateReport([[maybe_unused]] const T& report, [[maybe_unused]] ValidationSink& sink) const {}
+
+        /**
+         * @brief Counts a decoded (consumed > 0) or failed record for its
+         * source when the per-source table is enabled.
+         */
+        void countSource(const AsterixMessage& message, size_t consumed) noexcept {
+            if (sources_ptr) [[unlikely]] {
+                sources_ptr->record(message.sourceIdentifier, consumed > 0);
+            }
+        }
+
+        /**
+         * @brief Calls one listener, timing it when latency histograms are on.
+         */
+        template <typename Callback>
+        void notifyListener(Callback&& callback) {
+            REACTORASTERIX_PROBE1(listener__entry, this);
+            if (latency_ptr) [[unlikely]] {
+                latency_ptr->timeListener(std::forward<Callback>(callback));
+            } else {
+                callback();
+            }
+            REACTORASTERIX_PROBE1(listener__return, this);
+        }
+
+        /**
+         * @brief Returns "now" in TOD units, cached per packet when possible.
+         */
+        [[nodiscard]] uint32_t currentTod() const noexcept {
+            return time_ptr ? time_ptr->currentTod() : TimeReference::systemTod();
+        }
+
         /**
          * @brief Maximum Field Record Number supported in the flat array.
          * 128 covers all standard ASTERIX categories (max ~70-80 FRNs).
@@ -137,9 +270,11 @@ class AsterixCategoryHandler : public IAsterixCategoryHandler {
         /**
          * @brief Internal method that handles the F-spec parsing and data decoding.
          *
-         * This method iterates through the F-spec bytes, identifies the presence of
-         * data items, and dispatches the decoding task to the corresponding handler.
-         * It returns the total number of bytes consumed from the data payload.
+         * This method turns the F-spec into an FRN presence mask, checks the
+         * mandatory items against it, sizes the leading run of fixed-length
+         * items from the registration, and dispatches the decoding task to the
+         * corresponding handlers. It returns the total number of bytes
+         * consumed from the data payload.
          *
          * @param fspec A pointer to the start of the Field Specification.
          * @param fspecSize The size of the F-spec in bytes.
@@ -153,6 +288,44 @@ class AsterixCategoryHandler : public IAsterixCategoryHandler {
                 std::string_view fspec,
                 std::string_view payload,
                 T& context);
+
+    private:
+        /**
+         * @brief Decodes a record checking every rule, see
+         * AsterixPacketHandler::enableValidation(). Failures are counted as
+         * in the normal path; every broken rule is also logged.
+         */
+        [[nodiscard]] size_t decodeValidated(std::string_view fspec, std::string_view payload, T& context);
+
+
+        /**
+         * @brief The cached plan of 'fspec', built on a miss; nullptr when
+         * the pattern cannot be planned (invalid, or too many items).
+         */
+        const DecodePlan* findPlan(std::string_view fspec) noexcept;
+
+        [[nodiscard]] bool buildPlan(std::string_view fspec, DecodePlan& plan) const noexcept;
+
+        [[nodiscard]] size_t decodeWithPlan(const DecodePlan& plan, std::string_view fspec,
+                                            std::string_view payload, T& context);
+
+        /**
+         * @brief Counts a failed record and returns 0.
+         */
+        size_t abortRecord([[maybe_unused]] unsigned frn,
+                           [[maybe_unused]] ProbeFailure reason,
+                           [[maybe_unused]] size_t remaining,
+                           std::atomic<uint64_t> AsterixStats::* counter,
+                           std::atomic<uint64_t> AsterixCategoryStats::* categoryCounter) noexcept {
+            REACTORASTERIX_PROBE4(record__failed, this, frn, static_cast<int>(reason), remaining);
+            if (stats_ptr) {
+                (stats_ptr->*counter).fetch_add(1, std::memory_order_relaxed);
+            }
+            if (category_ptr) {
+                addSingleWriter(category_ptr->*categoryCounter);
+            }
+            return 0;
+        }
 };
 
 template <typename T>
@@ -161,80 +334,250 @@ size_t AsterixCategoryHandler<T>::_processDataRecordInternal(
         std::string_view payload,
         T& context) {
 
-    uint16_t frn_base = 1;
+    if (validation_ptr) [[unlikely]] {
+        return decodeValidated(fspec, payload, context);
+    }
+
+    // Known FSPEC pattern: replay its plan
+    if (const DecodePlan* plan = findPlan(fspec)) [[likely]] {
+        return decodeWithPlan(*plan, fspec, payload, context);
+    }
 
     std::string_view remainingData = payload;
 
     // Helper to log and exit
-    auto abortWithStat = [&](std::atomic<uint64_t>& counter) -> size_t {
-        if (stats_ptr) {
-            counter.fetch_add(1, std::memory_order_relaxed);
-        }
-        return 0;
+    auto abortWithStat = [&](unsigned frn,
+                             ProbeFailure reason,
+                             std::atomic<uint64_t> AsterixStats::* counter,
+                             std::atomic<uint64_t> AsterixCategoryStats::* categoryCounter) -> size_t {
+        return abortRecord(frn, reason, remainingData.size(), counter, categoryCounter);
     };
 
+    // Every item announced by the F-spec, in payload order
+    Fspec::FrnMask present = Fspec::presence(fspec);
+
     // 1. Validate Mandatory Fields
-    if (fspec.size() < mandatoryFspecSize) [[unlikely]] {
-        return abortWithStat(stats_ptr->protocolViolations);
+    if (const Fspec::FrnMask missing = mandatoryItems & ~present; missing.any()) [[unlikely]] {
+        return abortWithStat(missing.first(), ProbeFailure::PROTOCOL_VIOLATION,
+                             &AsterixStats::protocolViolations, &AsterixCategoryStats::protocolViolations);
     }
 
-    // 2nd Check: Detailed bit-level comparison
-    for (size_t i = 0; i < mandatoryFspecSize; ++i) {
-        // (required & ~received) identifies mandatory bits NOT present in received F-spec.
-        if (mandatoryFspec[i] & ~static_cast<uint8_t>(fspec[i])) [[unlikely]] {
-            return abortWithStat(stats_ptr->protocolViolations);
+    // The last F-spec byte must close it (FX bit clear)
+    if (fspec.empty() || (static_cast<uint8_t>(fspec.back()) & Constants::FX_BIT)) [[unlikely]] {
+        return abortWithStat(0, ProbeFailure::MALFORMED_RECORD,
+                             &AsterixStats::malformedRecords, &AsterixCategoryStats::malformedRecords);
+    }
+
+    // 2. Fixed-length prefix: the items before the first variable-length
+    // (or unregistered) one take their size from the registration instead
+    // of a virtual getSize() call
+    const Fspec::FrnMask variable = present & ~fixedItems;
+    Fspec::FrnMask prefix = variable.any() ? present & Fspec::FrnMask::below(variable.first()) : present;
+    present &= ~prefix;
+
+    while (prefix.any()) {
+        const unsigned frn = prefix.pop();
+        const size_t itemSize = fixedSizes[frn - 1];
+        if (itemSize > remainingData.size()) [[unlikely]] {
+            return abortWithStat(frn, ProbeFailure::MALFORMED_RECORD,
+                                 &AsterixStats::malformedRecords, &AsterixCategoryStats::malformedRecords);
         }
+        itemLookup[frn - 1]->decode(context, remainingData.substr(0, itemSize));
+        remainingData.remove_prefix(itemSize);
     }
 
-    // Loop through each byte of the F-spec.
-    for (const char c : fspec) {
-        const uint8_t fspecByte = static_cast<uint8_t>(c);
+    // 3. Remaining items, sized one at a time
+    while (present.any()) {
+        const unsigned currentFrn = present.pop();
+
+        // Direct array access instead of vector lookup.
+        // If FRN is within bounds, the CPU likely has this in the L1/L2 cache.
+        // Get the handler first (nullptr if out of bounds or not registered)
+        IAsterixDataItemHandler<T>* handler = itemLookup[currentFrn - 1];
+
+        // BIT RAISED: We must decode this item
+        if (handler) [[likely]] {
+            // Determine item size and check buffer bounds.
+            auto itemSize = handler->getSize(remainingData);
+            if (itemSize == 0 || itemSize > remainingData.size()) {
+                // Not enough data was found in the payload for this item.
+                return abortWithStat(currentFrn, ProbeFailure::MALFORMED_RECORD,
+                                     &AsterixStats::malformedRecords, &AsterixCategoryStats::malformedRecords);
+            }
 
-        uint8_t itemBits = fspecByte & 0xFE; // Strip FX bit
+            // Decode the data into the context object and advance pointers.
+            handler->decode(context, remainingData.substr(0, itemSize));
 
-        // Quick exit if no items in this byte
-        while (itemBits) {
-            // Get the index (0-6) of the highest set bit
-            int offset = __builtin_clz(static_cast<uint32_t>(itemBits) << 24);
-            uint16_t currentFrn = static_cast<uint16_t>(frn_base + offset);
+            remainingData.remove_prefix(itemSize);
+        } else {
+            // Update stats for missing decoder.
+            return abortWithStat(currentFrn, ProbeFailure::UNHANDLED_ITEM,
+                                 &AsterixStats::unhandledItems, &AsterixCategoryStats::unhandledItems);
+        }
+    }
 
-            // Direct array access instead of vector lookup.
-            // If FRN is within bounds, the CPU likely has this in the L1/L2 cache.
-            // Get the handler first (nullptr if out of bounds or not registered)
-            IAsterixDataItemHandler<T>* handler = itemLookup[currentFrn - 1];
+    REACTORASTERIX_PROBE3(record__done, this, fspec.size(), payload.size() - remainingData.size());
+    return payload.size() - remainingData.size();
+}
 
-            // BIT RAISED: We must decode this item
-            if (handler) [[likely]] {
-                // Determine item size and check buffer bounds.
-                auto itemSize = handler->getSize(remainingData);
-                if (itemSize == 0 || itemSize > remainingData.size()) {
-                    // Not enough data was found in the payload for this item.
-                    return abortWithStat(stats_ptr->malformedRecords);
-                }
+template <typename T>
+const typename AsterixCategoryHandler<T>::DecodePlan*
+AsterixCategoryHandler<T>::findPlan(std::string_view fspec) noexcept {
+    if (fspec.empty() || fspec.size() > Constants::MAX_FSPEC_SIZE) [[unlikely]] return nullptr;
+
+    uint64_t keyLow = 0;
+    uint64_t keyHigh = 0;
+    for (size_t i = 0; i < fspec.size(); ++i) {
+        const uint64_t byte = static_cast<uint8_t>(fspec[i]);
+        if (i < 8) {
+            keyLow |= byte << (8 * i);
+        } else {
+            keyHigh |= byte << (8 * (i - 8));
+        }
+    }
 
-                // Decode the data into the context object and advance pointers.
-                handler->decode(context, remainingData.substr(0, itemSize));
+    // Fibonacci hashing of the key on the cache index bits
+    static_assert((PLAN_CACHE_SIZE & (PLAN_CACHE_SIZE - 1)) == 0);
+    const uint64_t hash = (keyLow ^ (keyHigh << 5) ^ fspec.size()) * 0x9E3779B97F4A7C15ULL;
+    DecodePlan& slot = plans[static_cast<size_t>(hash >> 60) & (PLAN_CACHE_SIZE - 1)];
 
-                remainingData.remove_prefix(itemSize);
-            } else {
-                // Update stats for missing decoder.
-                return abortWithStat(stats_ptr->unhandledItems);
-            }
+    if (slot.keySize == fspec.size() && slot.keyLow == keyLow && slot.keyHigh == keyHigh) [[likely]] {
+        return &slot;
+    }
+
+    // Miss: only valid patterns replace the slot
+    DecodePlan plan;
+    if (!buildPlan(fspec, plan)) return nullptr;
+
+    plan.keyLow  = keyLow;
+    plan.keyHigh = keyHigh;
+    plan.keySize = static_cast<uint8_t>(fspec.size());
+    slot = plan;
+    return &slot;
+}
 
-            // Clear the bit we just processed to find the next one
-            itemBits &= static_cast<uint8_t>(~(0x80 >> offset));
+template <typename T>
+bool AsterixCategoryHandler<T>::buildPlan(std::string_view fspec, DecodePlan& plan) const noexcept {
+    // Same rules as the general path, which reports the failures
+    if (static_cast<uint8_t>(fspec.back()) & Constants::FX_BIT) return false;
+
+    Fspec::FrnMask present = Fspec::presence(fspec);
+    if ((mandatoryItems & ~present).any()) return false;
+
+    plan.allFixed = true;
+    size_t offset = 0;
+    while (present.any()) {
+        const unsigned frn = present.pop();
+        IAsterixDataItemHandler<T>* handler = itemLookup[frn - 1];
+        if (!handler || plan.itemCount == DecodePlan::MAX_ITEMS) return false;
+
+        const size_t i = plan.itemCount++;
+        plan.frns[i]    = static_cast<uint8_t>(frn);
+        plan.sizes[i]   = fixedSizes[frn - 1];
+        plan.offsets[i] = static_cast<uint16_t>(offset);
+        plan.items[i]   = handler;
+
+        plan.allFixed = plan.allFixed && plan.sizes[i] > 0;
+        offset += plan.sizes[i];
+    }
+
+    plan.totalSize = static_cast<uint16_t>(offset);
+    return plan.itemCount > 0;
+}
+
+template <typename T>
+size_t AsterixCategoryHandler<T>::decodeWithPlan(const DecodePlan& plan, [[maybe_unused]] std::string_view fspec,
+                                                 std::string_view payload, T& context) {
+    if (plan.allFixed) [[likely]] {
+        if (plan.totalSize > payload.size()) [[unlikely]] {
+            // Report the first item that does not fit
+            size_t i = 0;
+            while (plan.offsets[i] + plan.sizes[i] <= payload.size()) ++i;
+            return abortRecord(plan.frns[i], ProbeFailure::MALFORMED_RECORD, payload.size() - plan.offsets[i],
+                               &AsterixStats::malformedRecords, &AsterixCategoryStats::malformedRecords);
         }
 
-        // If the FX bit (0x01) is NOT set, this is the last F-spec byte
-        if (!(fspecByte & 0x01)) {
-            return payload.size() - remainingData.size();
+        for (size_t i = 0; i < plan.itemCount; ++i) {
+            plan.items[i]->decode(context, payload.substr(plan.offsets[i], plan.sizes[i]));
         }
 
-        frn_base += 7;
+        REACTORASTERIX_PROBE3(record__done, this, fspec.size(), plan.totalSize);
+        return plan.totalSize;
     }
 
-    // If we reach here, the loop finished but the last byte had FX=1
-    return abortWithStat(stats_ptr->malformedRecords);
+    std::string_view remainingData = payload;
+    for (size_t i = 0; i < plan.itemCount; ++i) {
+        const size_t itemSize = plan.sizes[i] ? plan.sizes[i] : plan.items[i]->getSize(remainingData);
+        if (itemSize == 0 || itemSize > remainingData.size()) [[unlikely]] {
+            return abortRecord(plan.frns[i], ProbeFailure::MALFORMED_RECORD, remainingData.size(),
+                               &AsterixStats::malformedRecords, &AsterixCategoryStats::malformedRecords);
+        }
+
+        plan.items[i]->decode(context, remainingData.substr(0, itemSize));
+        remainingData.remove_prefix(itemSize);
+    }
+
+    REACTORASTERIX_PROBE3(record__done, this, fspec.size(), payload.size() - remainingData.size());
+    return payload.size() - remainingData.size();
+}
+
+template <typename T>
+size_t AsterixCategoryHandler<T>::decodeValidated(std::string_view fspec, std::string_view payload, T& context) {
+    ValidationSink sink(*validation_ptr, validation_ptr->beginRecord(), validationCategory);
+
+    // Record-level rules first, all of them reported
+    Fspec::FrnMask present = Fspec::presence(fspec);
+    const bool closed = !fspec.empty() && !(static_cast<uint8_t>(fspec.back()) & Constants::FX_BIT);
+    if (!closed) [[unlikely]] {
+        sink.failAt(ValidationRule::FSPEC_NOT_CLOSED, 0, fspec.empty() ? 0 : fspec.size() - 1);
+    }
+
+    Fspec::FrnMask missing = mandatoryItems & ~present;
+    const bool complete = !missing.any();
+    while (missing.any()) {
+        sink.failAt(ValidationRule::MANDATORY_ITEM_MISSING, missing.pop(), 0);
+    }
+
+    if (!complete) [[unlikely]] {
+        return abortRecord(0, ProbeFailure::PROTOCOL_VIOLATION, payload.size(),
+                           &AsterixStats::protocolViolations, &AsterixCategoryStats::protocolViolations);
+    }
+    if (!closed) [[unlikely]] {
+        return abortRecord(0, ProbeFailure::MALFORMED_RECORD, payload.size(),
+                           &AsterixStats::malformedRecords, &AsterixCategoryStats::malformedRecords);
+    }
+
+    // Items: checked, then decoded
+    std::string_view remainingData = payload;
+    while (present.any()) {
+        const unsigned frn = present.pop();
+        const size_t offset = fspec.size() + payload.size() - remainingData.size();
+
+        IAsterixDataItemHandler<T>* handler = itemLookup[frn - 1];
+        if (!handler) [[unlikely]] {
+            sink.failAt(ValidationRule::UNHANDLED_ITEM, frn, offset);
+            return abortRecord(frn, ProbeFailure::UNHANDLED_ITEM, remainingData.size(),
+                               &AsterixStats::unhandledItems, &AsterixCategoryStats::unhandledItems);
+        }
+
+        const size_t itemSize = handler->getSize(remainingData);
+        if (itemSize == 0 || itemSize > remainingData.size()) [[unlikely]] {
+            sink.failAt(ValidationRule::ITEM_TRUNCATED, frn, offset);
+            return abortRecord(frn, ProbeFailure::MALFORMED_RECORD, remainingData.size(),
+                               &AsterixStats::malformedRecords, &AsterixCategoryStats::malformedRecords);
+        }
+
+        const std::string_view item = remainingData.substr(0, itemSize);
+        sink.setItem(frn, offset);
+        handler->validate(item, sink);
+        handler->decode(context, item);
+        remainingData.remove_prefix(itemSize);
+    }
+
+    validateReport(context, sink);
+
+    REACTORASTERIX_PROBE3(record__done, this, fspec.size(), payload.size() - remainingData.size());
+    return payload.size() - remainingData.size();
 }
 
 template <typename T>
@@ -44,6 +44,10 @@ class AsterixDataItemHandlerFixedLength : public AsterixDataItemHandlerBase<T> {
             return fixedSize;
         };
 
+        size_t getFixedSize() const final {
+            return fixedSize;
+        }
+
     protected:
         uint8_t fixedSize;
 };
@@ -18,8 +18,14 @@
 #pragma once
 
 // System headers
+#include <array>
 #include <atomic>
 #include <cstdint>
+#include <vector>
+
+// Library headers
+#include <ReactorAsterix/core/LatencyHistogram.h>
+#include <ReactorAsterix/core/SourceIdentifier.h>
 
 namespace ReactorAsterix {
 
@@ -37,6 +43,22 @@ namespace ReactorAsterix {
         uint64_t protocolViolations{0};
         uint64_t unhandledItems{0};
         uint64_t uninterpretedItems{0};
+
+        /**
+         * @brief Accumulates another snapshot, e.g. from a sibling handler.
+         */
+        AsterixStatsData& operator+=(const AsterixStatsData& other) noexcept {
+            totalPackets        += other.totalPackets;
+            trailingBytesCount  += other.trailingBytesCount;
+            unhandledCategories += other.unhandledCategories;
+            malformedBlocks     += other.malformedBlocks;
+            malformedRecords    += other.malformedRecords;
+            recordParseErrors   += other.recordParseErrors;
+            protocolViolations  += other.protocolViolations;
+            unhandledItems      += other.unhandledItems;
+            uninterpretedItems  += other.uninterpretedItems;
+            return *this;
+        }
     };
 
     /**
@@ -70,7 +92,8 @@ namespace ReactorAsterix {
                 malformedRecords.load(std::memory_order_relaxed),
                 recordParseErrors.load(std::memory_order_relaxed),
                 protocolViolations.load(std::memory_order_relaxed),
-                unhandledItems.load(std::memory_order_relaxed)
+                unhandledItems.load(std::memory_order_relaxed),
+                uninterpretedItems.load(std::memory_order_relaxed)
             };
         }
 
@@ -86,6 +109,175 @@ namespace ReactorAsterix {
             recordParseErrors.store(0, std::memory_order_relaxed);
             protocolViolations.store(0, std::memory_order_relaxed);
             unhandledItems.store(0, std::memory_order_relaxed);
+            uninterpretedItems.store(0, std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * @brief Adds to a counter that only one thread writes.
+     * A relaxed load and store: no locked instruction, no contention.
+     */
+    inline void addSingleWriter(std::atomic<uint64_t>& counter, uint64_t delta = 1) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copyable counters of one ASTERIX category.
+     */
+    struct AsterixCategoryStatsData {
+        uint8_t  category{0};
+        uint64_t blocks{0};
+        uint64_t records{0};
+        uint64_t bytes{0};              // Data block bytes, headers included
+        uint64_t unhandledBlocks{0};    // No handler registered for the category
+        uint64_t malformedBlocks{0};
+        uint64_t malformedRecords{0};
+        uint64_t recordParseErrors{0};
+        uint64_t protocolViolations{0};
+        uint64_t unhandledItems{0};
+
+        AsterixCategoryStatsData& operator+=(const AsterixCategoryStatsData& other) noexcept {
+            blocks             += other.blocks;
+            records            += other.records;
+            bytes              += other.bytes;
+            unhandledBlocks    += other.unhandledBlocks;
+            malformedBlocks    += other.malformedBlocks;
+            malformedRecords   += other.malformedRecords;
+            recordParseErrors  += other.recordParseErrors;
+            protocolViolations += other.protocolViolations;
+            unhandledItems     += other.unhandledItems;
+            return *this;
+        }
+    };
+
+    /**
+     * @brief Counters of one ASTERIX category.
+     * Written by the decoding thread only (see addSingleWriter()).
+     */
+    struct AsterixCategoryStats {
+        std::atomic<uint64_t> blocks{0};
+        std::atomic<uint64_t> records{0};
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<uint64_t> unhandledBlocks{0};
+        std::atomic<uint64_t> malformedBlocks{0};
+        std::atomic<uint64_t> malformedRecords{0};
+        std::atomic<uint64_t> recordParseErrors{0};
+        std::atomic<uint64_t> protocolViolations{0};
+        std::atomic<uint64_t> unhandledItems{0};
+
+        [[nodiscard]] AsterixCategoryStatsData snapshot(uint8_t category) const noexcept {
+            return {
+                category,
+                blocks.load(std::memory_order_relaxed),
+                records.load(std::memory_order_relaxed),
+                bytes.load(std::memory_order_relaxed),
+                unhandledBlocks.load(std::memory_order_relaxed),
+                malformedBlocks.load(std::memory_order_relaxed),
+                malformedRecords.load(std::memory_order_relaxed),
+                recordParseErrors.load(std::memory_order_relaxed),
+                protocolViolations.load(std::memory_order_relaxed),
+                unhandledItems.load(std::memory_order_relaxed)
+            };
+        }
+    };
+
+    /**
+     * @brief Copyable counters of one radar (SAC/SIC).
+     */
+    struct AsterixSourceStatsData {
+        SourceIdentifier source{};
+        uint64_t records{0};
+        uint64_t errors{0};
+    };
+
+    /**
+     * @brief Flat per-SAC/SIC record counters, indexed by (SAC << 8) | SIC.
+     *
+     * Records whose SAC/SIC could not be decoded count under 0/0.
+     * Written by the decoding thread only; snapshot() may run anywhere.
+     */
+    class AsterixSourceStats {
+        public:
+            void record(SourceIdentifier source, bool ok) noexcept {
+                Counters& c = counters[index(source)];
+                addSingleWriter(ok ? c.records : c.errors);
+            }
+
+            /**
+             * @brief The sources seen so far, in SAC/SIC order.
+             */
+            [[nodiscard]] std::vector<AsterixSourceStatsData> snapshot() const {
+                std::vector<AsterixSourceStatsData> out;
+                for (size_t i = 0; i < counters.size(); ++i) {
+                    const uint64_t records = counters[i].records.load(std::memory_order_relaxed);
+                    const uint64_t errors  = counters[i].errors.load(std::memory_order_relaxed);
+                    if (records == 0 && errors == 0) continue;
+                    out.push_back({{static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(i)}, records, errors});
+                }
+                return out;
+            }
+
+        private:
+            struct Counters {
+                std::atomic<uint64_t> records{0};
+                std::atomic<uint64_t> errors{0};
+            };
+
+            static size_t index(SourceIdentifier source) noexcept {
+                return (static_cast<size_t>(source.sac) << 8) | source.sic;
+            }
+
+            std::array<Counters, 65536> counters{};
+    };
+
+    /**
+     * @brief Copyable snapshot of the latency histograms.
+     */
+    struct AsterixLatencyData {
+        LatencySnapshot receive;  // Receive timestamp -> handlePacket() start
+        LatencySnapshot decode;   // Per data block, listener time excluded
+        LatencySnapshot listener; // Per listener callback
+
+        AsterixLatencyData& operator+=(const AsterixLatencyData& other) noexcept {
+            receive  += other.receive;
+            decode   += other.decode;
+            listener += other.listener;
+            return *this;
+        }
+    };
+
+    /**
+     * @brief Latency histograms of one AsterixPacketHandler.
+     * Written by the decoding thread only; snapshot() may run anywhere.
+     */
+    struct AsterixLatencyStats {
+        LatencyHistogram receive;
+        LatencyHistogram decode;
+        LatencyHistogram listener;
+
+        // Listener time spent inside the current block (decoding thread only)
+        uint64_t listenerNanosInBlock{0};
+
+        /**
+         * @brief Times one listener callback.
+         */
+        template <typename Callback>
+        void timeListener(Callback&& callback) {
+            const uint64_t start = LatencyHistogram::monotonicNanos();
+            callback();
+            const uint64_t elapsed = LatencyHistogram::monotonicNanos() - start;
+            listener.record(elapsed);
+            listenerNanosInBlock += elapsed;
+        }
+
+        [[nodiscard]] AsterixLatencyData snapshot() const noexcept {
+            return {receive.snapshot(), decode.snapshot(), listener.snapshot()};
+        }
+
+        void reset() noexcept {
+            receive.reset();
+            decode.reset();
+            listener.reset();
         }
     };
 }
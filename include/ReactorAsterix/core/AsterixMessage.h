@@ -37,10 +37,10 @@ class AsterixMessage {
         virtual ~AsterixMessage() = default;
 
         // Uniquely identifies the radar station
-        SourceIdentifier sourceIdentifier;
+        SourceIdentifier sourceIdentifier{};
 
         // The time the message was received
-        uint32_t TOD;
+        uint32_t TOD{0};
 
         // Reusable setter used by Ixxx/010 Handlers across all categories
         void setSourceIdentifier(uint8_t sac, uint8_t sic) {
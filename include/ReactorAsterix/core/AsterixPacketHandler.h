@@ -19,6 +19,7 @@
 
 // System headers
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -30,9 +31,20 @@
 // Library headers
 #include <ReactorAsterix/core/IAsterixCategoryHandler.h>
 #include <ReactorAsterix/core/AsterixDiagnostics.h>
+#include <ReactorAsterix/core/AsterixValidation.h>
+#include <ReactorAsterix/core/TimeReference.h>
 
 namespace ReactorAsterix {
 
+/**
+ * @brief A received datagram, as handed over in batches by the receivers.
+ */
+struct AsterixDatagram {
+    const uint8_t* data;
+    size_t size;
+    struct timespec ts; // Receive timestamp, zero if unknown
+};
+
 /**
  * @class AsterixPacketHandler
  * @brief The central engine for the ReactorAsterix library.
@@ -73,6 +85,14 @@ class alignas(std::hardware_destructive_interference_size) AsterixPacketHandler
          */
         void handlePacket(const uint8_t data[], size_t size, struct timespec ts);
 
+        /**
+         * @brief Processes a batch of datagrams, e.g. one recvmmsg() worth.
+         *
+         * @param datagrams The datagrams, in reception order.
+         * @param count The number of datagrams.
+         */
+        void handlePackets(const AsterixDatagram datagrams[], size_t count);
+
         /**
          * @brief Registers a specialized handler for a specific ASTERIX category.
          *
@@ -95,6 +115,85 @@ class alignas(std::hardware_destructive_interference_size) AsterixPacketHandler
          */
         [[nodiscard]] AsterixStatsData getStatsSnapshot() const { return stats.snapshot(); }
 
+        /**
+         * @brief Counters of one category: blocks, records, bytes and errors.
+         */
+        [[nodiscard]] AsterixCategoryStatsData getCategorySnapshot(uint8_t category) const {
+            return categoryStats[category].snapshot(category);
+        }
+
+        /**
+         * @brief Counters of every category seen so far, in category order.
+         */
+        [[nodiscard]] std::vector<AsterixCategoryStatsData> getCategoryBreakdown() const;
+
+        /**
+         * @brief Turns the per-SAC/SIC counter table (1 MiB) on or off.
+         * Same threading rules and lifetime as enableLatencyHistograms().
+         */
+        void enableSourceStats(bool enable = true);
+
+        /**
+         * @brief Counters of every SAC/SIC seen while enableSourceStats() was on
+         * (empty when off).
+         */
+        [[nodiscard]] std::vector<AsterixSourceStatsData> getSourceBreakdown() const {
+            const AsterixSourceStats* table = sourceStats.load(std::memory_order_acquire);
+            return table ? table->snapshot() : std::vector<AsterixSourceStatsData>{};
+        }
+
+        /**
+         * @brief Turns the latency histograms on or off.
+         *
+         * When on, the handler records the receive-to-decode delay of every
+         * packet carrying a timestamp, the decode time of every data block
+         * and the duration of every listener callback. Call it from the
+         * decoding thread or before decoding starts; use one handler per
+         * thread and merge the snapshots.
+         *
+         * The histograms are allocated on the first call and kept until the
+         * handler is destroyed, so snapshots may run on any thread while
+         * they are turned off; turning them back on resumes their counts.
+         */
+        void enableLatencyHistograms(bool enable = true);
+
+        /**
+         * @brief Copyable snapshot of the latency histograms (empty when off).
+         */
+        [[nodiscard]] AsterixLatencyData getLatencySnapshot() const {
+            const AsterixLatencyStats* histograms = latency.load(std::memory_order_acquire);
+            return histograms ? histograms->snapshot() : AsterixLatencyData{};
+        }
+
+        /**
+         * @brief Turns strict validation mode on or off.
+         *
+         * When on, every record is checked against all the rules its
+         * decoders know (reserved and spare bits, value ranges, extensions,
+         * category rules) and each broken rule is queued as a
+         * ValidationError; a consumer thread drains them with
+         * getValidationLog()->tryPop(). Records are still decoded and
+         * counted as usual. Same threading rules and lifetime as
+         * enableLatencyHistograms(): a consumer may keep draining the log
+         * after it is turned off.
+         *
+         * @param capacity Minimum number of queued errors; further errors are
+         * dropped and counted until the consumer catches up. Only the first
+         * call that turns validation on allocates the log.
+         */
+        void enableValidation(bool enable = true, size_t capacity = 65536);
+
+        /**
+         * @brief The queued errors of strict validation mode, null when off.
+         */
+        [[nodiscard]] AsterixValidationLog* getValidationLog() { return validation.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Gives access to the time reference shared by all registered
+         * category handlers, e.g. to select its source or tick.
+         */
+        [[nodiscard]] TimeReference& getTimeReference() { return timeReference; }
+
     private:
         /**
          * @brief Internal logic to parse the ASTERIX Block header (CAT + LEN).
@@ -126,6 +225,27 @@ class alignas(std::hardware_destructive_interference_size) AsterixPacketHandler
         std::vector<std::unique_ptr<IAsterixCategoryHandler>> categoryPool;
 
         AsterixStats stats{}; // The stats object is stored here
+
+        // Latency histograms, allocated on first enable and never freed
+        // before the handler: other threads may be taking a snapshot
+        std::unique_ptr<AsterixLatencyStats> latencyStorage;
+        std::atomic<AsterixLatencyStats*> latency{nullptr}; // Null when off
+
+        // Per-category counters, written by the decoding thread only
+        std::array<AsterixCategoryStats, 256> categoryStats{};
+
+        // Per-SAC/SIC counters, allocated on first enable and never freed
+        // before the handler, like the latency histograms
+        std::unique_ptr<AsterixSourceStats> sourceStorage;
+        std::atomic<AsterixSourceStats*> sourceStats{nullptr}; // Null when off
+
+        // Errors of strict validation mode, allocated on first enable and
+        // never freed before the handler: a consumer may be draining them
+        std::unique_ptr<AsterixValidationLog> validationStorage;
+        std::atomic<AsterixValidationLog*> validation{nullptr}; // Null when off
+
+        // "Now" for sources without history, computed at most once per packet
+        TimeReference timeReference{};
 };
 
 } // namespace ReactorAsterix
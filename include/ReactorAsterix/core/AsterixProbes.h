@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/**
+ * @file AsterixProbes.h
+ * @brief USDT static probes of the decoding hot paths (provider "reactorasterix").
+ *
+ * Built with REACTORASTERIX_HAVE_USDT (CMake option REACTORASTERIX_USDT),
+ * each probe is a single nop until a tracer attaches; otherwise the macros
+ * expand to nothing. Probes and arguments:
+ *
+ *   packet__entry     (data, size, ts.tv_sec, ts.tv_nsec)
+ *   block__dispatch   (category, length, handler registered)
+ *   block__malformed  (category, length, bytes available)
+ *   record__done      (handler, fspec size, bytes consumed)
+ *   record__failed    (handler, FRN, ProbeFailure, bytes left)
+ *   listener__entry   (handler)
+ *   listener__return  (handler)
+ *
+ * Example: bpftrace -e 'usdt:./libReactorAsterix.so:reactorasterix:record__failed
+ *                       { @[arg1, arg2] = count(); }'
+ */
+
+#ifdef REACTORASTERIX_HAVE_USDT
+
+#include <sys/sdt.h>
+
+#define REACTORASTERIX_PROBE1(name, a1) \
+    DTRACE_PROBE1(reactorasterix, name, a1)
+#define REACTORASTERIX_PROBE2(name, a1, a2) \
+    DTRACE_PROBE2(reactorasterix, name, a1, a2)
+#define REACTORASTERIX_PROBE3(name, a1, a2, a3) \
+    DTRACE_PROBE3(reactorasterix, name, a1, a2, a3)
+#define REACTORASTERIX_PROBE4(name, a1, a2, a3, a4) \
+    DTRACE_PROBE4(reactorasterix, name, a1, a2, a3, a4)
+
+#else
+
+#define REACTORASTERIX_PROBE1(name, a1) do {} while (0)
+#define REACTORASTERIX_PROBE2(name, a1, a2) do {} while (0)
+#define REACTORASTERIX_PROBE3(name, a1, a2, a3) do {} while (0)
+#define REACTORASTERIX_PROBE4(name, a1, a2, a3, a4) do {} while (0)
+
+#endif
+
+namespace ReactorAsterix {
+
+/**
+ * @brief Why a record failed, as reported by the record__failed probe.
+ */
+enum class ProbeFailure : int {
+    PROTOCOL_VIOLATION = 1, // A mandatory item is missing
+    MALFORMED_RECORD   = 2, // An item is truncated or the FSPEC never ends
+    UNHANDLED_ITEM     = 3  // No decoder registered for the FRN
+};
+
+} // namespace ReactorAsterix
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
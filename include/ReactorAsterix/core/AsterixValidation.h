@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Library headers
+#include <ReactorAsterix/core/AsterixDiagnostics.h>
+#include <ReactorAsterix/core/SpscRing.h>
+
+namespace ReactorAsterix {
+
+/**
+ * @brief Identifies the rule a record breaks in strict validation mode.
+ *
+ * Generic rules apply to any item, the FRN of the error telling which
+ * one; category rules start at 100 for CAT001, 200 for CAT002.
+ */
+enum class ValidationRule : uint16_t {
+    FSPEC_NOT_CLOSED        = 1,  // The FSPEC never ends, or its last byte has FX set
+    MANDATORY_ITEM_MISSING  = 2,
+    UNHANDLED_ITEM          = 3,  // No decoder registered for the FRN
+    ITEM_TRUNCATED          = 4,
+    RESERVED_BITS           = 5,
+    SPARE_BITS              = 6,
+    VALUE_OUT_OF_RANGE      = 7,
+    UNEXPECTED_EXTENSION    = 8,  // FX set on the last octet the item defines
+
+    CAT001_PRIMARY_WITH_SSR_DATA   = 101, // Sole primary plot carrying Mode-3/A or Mode-C
+    CAT002_SECTOR_WITHOUT_NUMBER   = 201  // Sector crossing without I002/020
+};
+
+/**
+ * @brief One broken rule, 16 bytes, no strings.
+ */
+struct ValidationError {
+    uint64_t record{0};       // Sequence number of the record, see AsterixValidationLog::records()
+    uint16_t offset{0};       // Byte offset from the start of the record (its FSPEC), 0 for category rules
+    ValidationRule rule{ValidationRule::FSPEC_NOT_CLOSED};
+    uint8_t  category{0};
+    uint8_t  frn{0};          // 0 for rules about the whole record
+};
+
+static_assert(sizeof(ValidationError) == 16);
+
+/**
+ * @class AsterixValidationLog
+ * @brief The errors found in strict validation mode, queued for a consumer
+ * thread.
+ *
+ * The decoding thread never waits: when the ring is full, new errors are
+ * dropped and counted. Counters are relaxed atomics written by the
+ * decoding thread only.
+ */
+class AsterixValidationLog {
+    public:
+        /**
+         * @brief Constructor.
+         * @param capacity Minimum number of queued errors, rounded up to a power of two.
+         */
+        explicit AsterixValidationLog(size_t capacity) : ring(capacity) {}
+
+        AsterixValidationLog(const AsterixValidationLog&) = delete;
+        AsterixValidationLog& operator=(const AsterixValidationLog&) = delete;
+
+        /**
+         * @brief Producer: numbers the next validated record.
+         */
+        uint64_t beginRecord() noexcept {
+            const uint64_t record = recordCount.load(std::memory_order_relaxed);
+            recordCount.store(record + 1, std::memory_order_relaxed);
+            return record;
+        }
+
+        /**
+         * @brief Producer: queues an error, or counts it as dropped.
+         */
+        void report(const ValidationError& error) noexcept {
+            addSingleWriter(ring.tryPush(error) ? errorCount : droppedCount);
+        }
+
+        /**
+         * @brief Consumer: takes the oldest queued error.
+         * @return false if none is queued.
+         */
+        [[nodiscard]] bool tryPop(ValidationError& error) noexcept { return ring.tryPop(error); }
+
+        [[nodiscard]] uint64_t records() const noexcept { return recordCount.load(std::memory_order_relaxed); }
+        [[nodiscard]] uint64_t errors() const noexcept { return errorCount.load(std::memory_order_relaxed); }
+        [[nodiscard]] uint64_t dropped() const noexcept { return droppedCount.load(std::memory_order_relaxed); }
+
+    private:
+        SpscRing<ValidationError> ring;
+        std::atomic<uint64_t> recordCount{0};
+        std::atomic<uint64_t> errorCount{0};
+        std::atomic<uint64_t> droppedCount{0};
+};
+
+/**
+ * @class ValidationSink
+ * @brief Reports the errors of one record, filling in its sequence number,
+ * category, current item and offsets.
+ */
+class ValidationSink {
+    public:
+        ValidationSink(AsterixValidationLog& _log, uint64_t _record, uint8_t _category) noexcept
+            : log(_log), record(_record), category(_category) {}
+
+        /**
+         * @brief Sets the item that fail() refers to and its offset in the record.
+         */
+        void setItem(unsigned _frn, size_t _offset) noexcept {
+            frn = static_cast<uint8_t>(_frn);
+            itemOffset = _offset;
+        }
+
+        /**
+         * @brief The current item breaks 'rule' at byte 'offset' of the item.
+         */
+        void fail(ValidationRule rule, size_t offset = 0) noexcept {
+            failAt(rule, frn, itemOffset + offset);
+        }
+
+        /**
+         * @brief Item 'frn' (0: the whole record) breaks 'rule' at byte
+         * 'offset' of the record.
+         */
+        void failAt(ValidationRule rule, unsigned _frn, size_t offset) noexcept {
+            ++errorCount;
+            log.report({record, static_cast<uint16_t>(offset), rule, category, static_cast<uint8_t>(_frn)});
+        }
+
+        /**
+         * @brief Errors reported for this record so far.
+         */
+        [[nodiscard]] size_t errors() const noexcept { return errorCount; }
+
+    private:
+        AsterixValidationLog& log;
+        uint64_t record;
+        uint8_t category;
+        uint8_t frn{0};
+        size_t itemOffset{0};
+        size_t errorCount{0};
+};
+
+} // namespace ReactorAsterix
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
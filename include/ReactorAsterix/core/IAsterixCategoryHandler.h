@@ -8,6 +8,11 @@
 namespace ReactorAsterix {
 
     struct AsterixStats; // Forward declaration
+    class TimeReference; // Forward declaration
+    struct AsterixLatencyStats; // Forward declaration
+    struct AsterixCategoryStats; // Forward declaration
+    class AsterixSourceStats; // Forward declaration
+    class AsterixValidationLog; // Forward declaration
 
     /**
      * @class IAsterixCategoryHandler
@@ -29,6 +34,32 @@ namespace ReactorAsterix {
             // New method to link stats to this handler
             virtual void setStats(AsterixStats& stats) = 0;
 
+            /**
+             * @brief Links the packet-scoped time reference to this handler.
+             * Handlers that never need "now" can ignore it.
+             */
+            virtual void setTimeReference([[maybe_unused]] TimeReference& timeReference) {}
+
+            /**
+             * @brief Links the latency histograms, or unlinks them with nullptr.
+             * Handlers that do not time their listeners can ignore it.
+             */
+            virtual void setLatencyStats([[maybe_unused]] AsterixLatencyStats* latencyStats) {}
+
+            /**
+             * @brief Links the counters of the handled category and the
+             * per-source table (nullptr when disabled).
+             */
+            virtual void setBreakdownStats([[maybe_unused]] AsterixCategoryStats* categoryStats,
+                                           [[maybe_unused]] AsterixSourceStats* sourceStats) {}
+
+            /**
+             * @brief Links the log of strict validation mode, or unlinks it
+             * with nullptr. Handlers that do not validate can ignore it.
+             */
+            virtual void setValidationLog([[maybe_unused]] AsterixValidationLog* validationLog,
+                                          [[maybe_unused]] uint8_t category) {}
+
             /**
              * @brief Handles the processing of a single ASTERIX data record.
              *
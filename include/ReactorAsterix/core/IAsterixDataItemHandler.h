@@ -25,6 +25,7 @@
 namespace ReactorAsterix {
 
     struct AsterixStats; // Forward declaration for diagnostic support
+    class ValidationSink; // Forward declaration for strict validation
 
 /**
  * @class IAsterixDataItemHandler
@@ -67,6 +68,16 @@ class IAsterixDataItemHandler {
          */
         virtual void decode(T& context, std::string_view data) const = 0;
 
+        /**
+         * @brief Checks the item in strict validation mode, before decode():
+         * reserved and spare bits, value ranges, extensions. Reports each
+         * broken rule to 'sink'; the default checks nothing.
+         *
+         * @param data The whole item, its size already checked.
+         * @param sink Where broken rules are reported.
+         */
+        virtual void validate([[maybe_unused]] std::string_view data, [[maybe_unused]] ValidationSink& sink) const {}
+
         /**
          * @brief Returns the size of the data item in bytes.
          *
@@ -80,6 +91,15 @@ class IAsterixDataItemHandler {
          */
         [[nodiscard]] virtual size_t getSize(std::string_view data) const = 0;
 
+        /**
+         * @brief Returns the size of a fixed-length item, 0 if it depends on
+         * the data.
+         *
+         * Runs of fixed-length items are sized in closed form by the
+         * category handler, without calling getSize() per item.
+         */
+        [[nodiscard]] virtual size_t getFixedSize() const { return 0; }
+
         /**
          * @brief Checks if the data item is mandatory.
          *
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+namespace ReactorAsterix {
+
+/**
+ * @brief Bucket layout shared by LatencyHistogram and LatencySnapshot.
+ *
+ * Log-linear (HDR-style) buckets: values below 16 ns have one bucket each,
+ * every power of two above is split into 16 sub-buckets, so a bucket is
+ * never wider than 1/16 of its value. Values from 2^40 ns (about 18 min)
+ * up land in the last bucket.
+ */
+struct LatencyBuckets {
+    static constexpr unsigned SUB_BUCKET_BITS = 4;
+    static constexpr unsigned SUB_BUCKETS     = 1u << SUB_BUCKET_BITS;
+    static constexpr unsigned MAX_EXPONENT    = 40;
+    static constexpr size_t   COUNT           = (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    [[nodiscard]] static constexpr size_t index(uint64_t nanos) noexcept {
+        if (nanos < SUB_BUCKETS) return static_cast<size_t>(nanos);
+
+        const auto exponent = static_cast<unsigned>(63 - __builtin_clzll(nanos));
+        if (exponent >= MAX_EXPONENT) return COUNT - 1;
+
+        const unsigned shift = exponent - SUB_BUCKET_BITS;
+        const auto mantissa = static_cast<size_t>((nanos >> shift) - SUB_BUCKETS);
+        return (shift + 1) * SUB_BUCKETS + mantissa;
+    }
+
+    // Largest value counted in bucket 'i'
+    [[nodiscard]] static constexpr uint64_t upperBound(size_t i) noexcept {
+        if (i < SUB_BUCKETS) return i;
+
+        const auto shift = static_cast<unsigned>(i / SUB_BUCKETS - 1);
+        const uint64_t lower = static_cast<uint64_t>(SUB_BUCKETS + i % SUB_BUCKETS) << shift;
+        return lower + (uint64_t{1} << shift) - 1;
+    }
+};
+
+/**
+ * @brief Copyable content of a LatencyHistogram; snapshots of several
+ * threads are merged with +=.
+ */
+struct LatencySnapshot {
+    uint64_t count{0};
+    uint64_t sumNanos{0};
+    uint64_t maxNanos{0};
+    std::array<uint64_t, LatencyBuckets::COUNT> buckets{};
+
+    LatencySnapshot& operator+=(const LatencySnapshot& other) noexcept {
+        count    += other.count;
+        sumNanos += other.sumNanos;
+        if (other.maxNanos > maxNanos) maxNanos = other.maxNanos;
+        for (size_t i = 0; i < buckets.size(); ++i) buckets[i] += other.buckets[i];
+        return *this;
+    }
+
+    [[nodiscard]] uint64_t meanNanos() const noexcept {
+        return count ? sumNanos / count : 0;
+    }
+
+    /**
+     * @brief Value at quantile q (0..1), within the bucket resolution.
+     * @return The upper bound of the bucket holding the quantile, never
+     * above the recorded maximum.
+     */
+    [[nodiscard]] uint64_t percentile(double q) const noexcept {
+        if (count == 0) return 0;
+        if (q >= 1.0) return maxNanos;
+
+        const auto rank = static_cast<uint64_t>(q * static_cast<double>(count));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < buckets.size(); ++i) {
+            seen += buckets[i];
+            if (seen > rank) {
+                const uint64_t bound = LatencyBuckets::upperBound(i);
+                return bound < maxNanos ? bound : maxNanos;
+            }
+        }
+        return maxNanos;
+    }
+};
+
+/**
+ * @class LatencyHistogram
+ * @brief Single-writer latency histogram.
+ *
+ * record() is called by the one thread owning the histogram and costs a
+ * few relaxed loads and stores, without any locked instruction. Any
+ * thread may take a snapshot at any time; it is consistent per bucket.
+ */
+class LatencyHistogram {
+    public:
+        void record(uint64_t nanos) noexcept {
+            bump(buckets[LatencyBuckets::index(nanos)], 1);
+            bump(count, 1);
+            bump(sumNanos, nanos);
+            if (nanos > maxNanos.load(std::memory_order_relaxed)) {
+                maxNanos.store(nanos, std::memory_order_relaxed);
+            }
+        }
+
+        [[nodiscard]] LatencySnapshot snapshot() const noexcept {
+            LatencySnapshot s;
+            s.count    = count.load(std::memory_order_relaxed);
+            s.sumNanos = sumNanos.load(std::memory_order_relaxed);
+            s.maxNanos = maxNanos.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < buckets.size(); ++i) {
+                s.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+            }
+            return s;
+        }
+
+        /**
+         * @brief Clears the histogram. Only call while the writer is idle.
+         */
+        void reset() noexcept {
+            count.store(0, std::memory_order_relaxed);
+            sumNanos.store(0, std::memory_order_relaxed);
+            maxNanos.store(0, std::memory_order_relaxed);
+            for (auto& bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief CLOCK_MONOTONIC in nanoseconds, for measuring durations.
+         */
+        [[nodiscard]] static uint64_t monotonicNanos() noexcept {
+            struct timespec ts{};
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            return static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ULL + static_cast<uint64_t>(ts.tv_nsec);
+        }
+
+    private:
+        // Single writer: no read-modify-write instruction needed
+        static void bump(std::atomic<uint64_t>& counter, uint64_t delta) noexcept {
+            counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+        }
+
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> sumNanos{0};
+        std::atomic<uint64_t> maxNanos{0};
+        std::array<std::atomic<uint64_t>, LatencyBuckets::COUNT> buckets{};
+};
+
+} // namespace ReactorAsterix
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ReactorAsterix {
+
+template <typename T>
+class ReportPool;
+
+namespace detail {
+    /**
+     * @brief A pooled slot: the report and its intrusive reference count.
+     */
+    template <typename T>
+    struct PoolNode {
+        T value{};
+        std::atomic<uint32_t> refs{0};
+        PoolNode* next = nullptr;
+        ReportPool<T>* owner = nullptr;
+    };
+}
+
+/**
+ * @class PooledReport
+ * @brief Intrusive ref-counted handle to a report taken from a ReportPool.
+ *
+ * Copying the handle only bumps the counter stored next to the report; the
+ * last handle to go away returns the slot to its pool. Handles can be kept
+ * and released from any thread.
+ */
+template <typename T>
+class PooledReport {
+    public:
+        PooledReport() noexcept = default;
+
+        PooledReport(const PooledReport& other) noexcept : node(other.node) {
+            if (node) node->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        PooledReport(PooledReport&& other) noexcept
+            : node(std::exchange(other.node, nullptr)) {}
+
+        PooledReport& operator=(PooledReport other) noexcept {
+            std::swap(node, other.node);
+            return *this;
+        }
+
+        ~PooledReport() { reset(); }
+
+        /**
+         * @brief Drops this reference, recycling the report if it was the last.
+         */
+        void reset() noexcept {
+            if (node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                node->owner->recycle(node);
+            }
+            node = nullptr;
+        }
+
+        [[nodiscard]] T& operator*() const noexcept { return node->value; }
+        [[nodiscard]] T* operator->() const noexcept { return &node->value; }
+        [[nodiscard]] T* get() const noexcept { return node ? &node->value : nullptr; }
+
+        explicit operator bool() const noexcept { return node != nullptr; }
+
+    private:
+        friend class ReportPool<T>;
+
+        explicit PooledReport(detail::PoolNode<T>* n) noexcept : node(n) {}
+
+        detail::PoolNode<T>* node = nullptr;
+};
+
+/**
+ * @class ReportPool
+ * @brief Chunked pool of reports handed out as PooledReport handles.
+ *
+ * acquire() must be called from a single thread (the decoding thread);
+ * handles may be released from any thread. Returned slots go onto a
+ * lock-free stack that the decoding thread takes over in one exchange, so
+ * the pool never sees the ABA problem.
+ *
+ * The pool outlives its owner while handles are still out: it is deleted
+ * by whoever drops the last reference, owner or handle.
+ */
+template <typename T>
+class ReportPool {
+    private:
+        struct Closer {
+            void operator()(ReportPool* pool) const noexcept { pool->unref(); }
+        };
+
+    public:
+        using Node  = detail::PoolNode<T>;
+        using Owner = std::unique_ptr<ReportPool, Closer>;
+
+        /**
+         * @brief Creates a pool growing by 'chunkSize' reports at a time.
+         */
+        [[nodiscard]] static Owner create(size_t chunkSize = 256) {
+            return Owner(new ReportPool(chunkSize));
+        }
+
+        ReportPool(const ReportPool&) = delete;
+        ReportPool& operator=(const ReportPool&) = delete;
+
+        /**
+         * @brief Takes a default-initialized report from the pool.
+         * Allocates a new chunk only when every report is in use.
+         */
+        [[nodiscard]] PooledReport<T> acquire() {
+            if (!freeList) [[unlikely]] {
+                freeList = returned.exchange(nullptr, std::memory_order_acquire);
+                if (!freeList) {
+                    grow();
+                }
+            }
+
+            Node* node = freeList;
+            freeList   = node->next;
+
+            node->value = T{};
+            node->refs.store(1, std::memory_order_relaxed);
+            liveRefs.fetch_add(1, std::memory_order_relaxed);
+
+            return PooledReport<T>(node);
+        }
+
+        /**
+         * @brief Number of reports allocated so far (in use or free).
+         */
+        [[nodiscard]] size_t capacity() const noexcept { return chunks.size() * chunkSize; }
+
+    private:
+        friend class PooledReport<T>;
+
+        explicit ReportPool(size_t _chunkSize) : chunkSize(_chunkSize ? _chunkSize : 1) {}
+
+        ~ReportPool() = default;
+
+        void grow() {
+            auto chunk = std::make_unique<Node[]>(chunkSize);
+            for (size_t i = 0; i < chunkSize; ++i) {
+                chunk[i].owner = this;
+                chunk[i].next  = (i + 1 < chunkSize) ? &chunk[i + 1] : freeList;
+            }
+            freeList = &chunk[0];
+            chunks.push_back(std::move(chunk));
+        }
+
+        // Called from any thread by the last handle of a report
+        void recycle(Node* node) noexcept {
+            Node* head = returned.load(std::memory_order_relaxed);
+            do {
+                node->next = head;
+            } while (!returned.compare_exchange_weak(head, node,
+                        std::memory_order_release, std::memory_order_relaxed));
+            unref();
+        }
+
+        void unref() noexcept {
+            if (liveRefs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete this;
+            }
+        }
+
+        const size_t chunkSize;
+
+        // Decoding thread only
+        Node* freeList = nullptr;
+        std::vector<std::unique_ptr<Node[]>> chunks;
+
+        // Reports released by other threads
+        std::atomic<Node*> returned{nullptr};
+
+        // One reference for the owner plus one per report in use
+        std::atomic<size_t> liveRefs{1};
+};
+
+} // namespace ReactorAsterix
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
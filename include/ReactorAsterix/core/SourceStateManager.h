@@ -27,14 +27,33 @@
 
 namespace ReactorAsterix {
 
+/**
+ * @brief Compact per-source antenna rotation state, driven by CAT 002.
+ * All times are in ASTERIX TOD units (1/128 s since midnight).
+ */
+struct ScanState {
+    enum Flags : uint8_t {
+        HAS_NORTH       = 0x01, // lastNorthTod is valid
+        HAS_SECTOR      = 0x02, // lastSectorTod/lastSector are valid
+        PERIOD_FROM_041 = 0x04  // scanPeriod comes from I002/041
+    };
+
+    uint32_t lastNorthTod{0};  // Last north crossing
+    uint32_t lastSectorTod{0}; // Last sector crossing
+    uint32_t scanPeriod{0};    // Antenna rotation period, 0 if unknown
+    uint32_t scanNumber{0};    // Number of north crossings seen
+    uint8_t  lastSector{0};    // Azimuth of the last sector (LSB = 360/256 deg)
+    uint8_t  flags{0};
+};
+
 class SourceStateManager {
     public:
         /**
          * @brief Returns the last known 32-bit TOD or 0xFFFFFFFF if unknown.
          */
         [[nodiscard]] std::optional<uint32_t> getReferenceTime(const SourceIdentifier& si) const {
-            if (const auto it = sources.find(si); it != sources.end()) {
-                return it->second;
+            if (const auto it = sources.find(si); it != sources.end() && it->second.hasReference) {
+                return it->second.referenceTod;
             }
             return std::nullopt;
         }
@@ -44,11 +63,63 @@ class SourceStateManager {
          * Can be called by CAT 002, 048, 062, etc., whenever a full TOD is available.
          */
         void updateSourceTime(const SourceIdentifier& si, uint32_t fullTod) {
-            sources.insert_or_assign(si, fullTod);
+            auto& state = sources[si];
+            state.referenceTod = fullTod;
+            state.hasReference = true;
         }
 
+        /**
+         * @brief Records a north crossing (CAT 002 North Marker message).
+         * The scan period is measured between consecutive markers unless the
+         * radar reports it through I002/041.
+         */
+        void updateNorthMarker(const SourceIdentifier& si, uint32_t tod);
+
+        /**
+         * @brief Records a sector crossing (CAT 002 Sector Crossing message).
+         */
+        void updateSectorCrossing(const SourceIdentifier& si, uint32_t tod, uint8_t sector);
+
+        /**
+         * @brief Records the antenna rotation period reported in I002/041.
+         * @param rawPeriod The raw item value (LSB = 1/128 s).
+         */
+        void updateAntennaPeriod(const SourceIdentifier& si, uint16_t rawPeriod);
+
+        /**
+         * @brief Returns the scan state of a source, if any CAT 002 was seen.
+         */
+        [[nodiscard]] std::optional<ScanState> getScanState(const SourceIdentifier& si) const {
+            if (const auto it = sources.find(si); it != sources.end() && it->second.scan.flags) {
+                return it->second.scan;
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Estimates when the antenna pointed at a given azimuth.
+         *
+         * Interpolates from the most recent north (or sector) crossing using
+         * the scan period. Requires at least one north crossing and a known
+         * period.
+         *
+         * @param si The source.
+         * @param azimuth The plot azimuth in radians (as in Asterix1Report).
+         * @param arrivalTod When the plot was received: the plot cannot be
+         * measured after it, which resolves the revolution around north.
+         * @return The estimated TOD, or nullopt if the scan is not tracked yet.
+         */
+        [[nodiscard]] std::optional<uint32_t> estimateTimeAtAzimuth(
+                const SourceIdentifier& si, double azimuth, uint32_t arrivalTod) const;
+
     private:
-        std::map<SourceIdentifier, uint32_t> sources;
+        struct SourceState {
+            uint32_t referenceTod{0};
+            bool hasReference{false};
+            ScanState scan{};
+        };
+
+        std::map<SourceIdentifier, SourceState> sources;
 };
 
 } // namespace ReactorAsterix
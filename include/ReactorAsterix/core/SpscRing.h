@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace ReactorAsterix {
+
+/**
+ * @class SpscRing
+ * @brief Bounded lock-free single-producer/single-consumer ring.
+ *
+ * Every slot carries a sequence number telling whether it is free or
+ * filled for a given lap. Besides the consumer, the producer may also take
+ * the oldest element (dropOldest) to make room; both claim it with a CAS on
+ * the tail, and a slot is only reused once its reader has released it.
+ *
+ * @tparam T A trivially copyable element type.
+ */
+template <typename T>
+class SpscRing {
+    static_assert(std::is_trivially_copyable_v<T>, "SpscRing stores trivially copyable types");
+
+    public:
+        /**
+         * @brief Constructor.
+         * @param requested Minimum capacity, rounded up to a power of two.
+         */
+        explicit SpscRing(size_t requested) {
+            size_t cap = 2;
+            while (cap < requested) cap <<= 1;
+
+            mask  = cap - 1;
+            slots = std::make_unique<Slot[]>(cap);
+            for (size_t i = 0; i < cap; ++i) {
+                slots[i].seq.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        SpscRing(const SpscRing&) = delete;
+        SpscRing& operator=(const SpscRing&) = delete;
+
+        /**
+         * @brief Producer: appends an element.
+         * @return false if the ring is full.
+         */
+        [[nodiscard]] bool tryPush(const T& value) noexcept {
+            const size_t pos = head.load(std::memory_order_relaxed);
+            Slot& slot = slots[pos & mask];
+
+            if (slot.seq.load(std::memory_order_acquire) != pos) {
+                return false;
+            }
+
+            slot.value = value;
+            slot.seq.store(pos + 1, std::memory_order_release);
+            head.store(pos + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * @brief Consumer: removes the oldest element.
+         * @return false if the ring is empty.
+         */
+        [[nodiscard]] bool tryPop(T& value) noexcept {
+            return take(&value);
+        }
+
+        /**
+         * @brief Producer: discards the oldest element to make room.
+         * @return false if the ring was empty.
+         */
+        bool dropOldest() noexcept {
+            return take(nullptr);
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            const size_t pos = tail.load(std::memory_order_acquire);
+            return slots[pos & mask].seq.load(std::memory_order_acquire) != pos + 1;
+        }
+
+        [[nodiscard]] size_t capacity() const noexcept { return mask + 1; }
+
+    private:
+        struct Slot {
+            std::atomic<size_t> seq{0};
+            T value;
+        };
+
+        bool take(T* out) noexcept {
+            size_t pos = tail.load(std::memory_order_relaxed);
+
+            while (true) {
+                Slot& slot = slots[pos & mask];
+                const size_t seq = slot.seq.load(std::memory_order_acquire);
+
+                if (seq != pos + 1) {
+                    // Either empty, or the other side already took this slot
+                    const size_t now = tail.load(std::memory_order_relaxed);
+                    if (now == pos) return false;
+                    pos = now;
+                    continue;
+                }
+
+                if (tail.compare_exchange_weak(pos, pos + 1,
+                            std::memory_order_relaxed, std::memory_order_relaxed)) {
+                    if (out) *out = slot.value;
+                    // Hand the slot back to the producer for the next lap
+                    slot.seq.store(pos + mask + 1, std::memory_order_release);
+                    return true;
+                }
+                // CAS failure reloaded pos
+            }
+        }
+
+        std::unique_ptr<Slot[]> slots;
+        size_t mask = 0;
+
+        alignas(std::hardware_destructive_interference_size) std::atomic<size_t> head{0};
+        alignas(std::hardware_destructive_interference_size) std::atomic<size_t> tail{0};
+};
+
+} // namespace ReactorAsterix
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+namespace ReactorAsterix {
+
+/**
+ * @class TimeReference
+ * @brief Lazily evaluated "now" expressed in ASTERIX Time of Day units (1/128 s).
+ *
+ * The AsterixPacketHandler hands the packet timestamp over once per packet.
+ * The TOD itself is only computed when a category handler actually needs a
+ * fallback reference, and is then reused for the rest of the packet (or for
+ * the rest of the configured tick).
+ *
+ * Not thread-safe: one instance belongs to one AsterixPacketHandler.
+ */
+class TimeReference {
+    public:
+        /**
+         * @brief Where "now" comes from.
+         */
+        enum class Source : uint8_t {
+            PacketTimestamp, // Receive timestamp of the packet, coarse clock if absent
+            CoarseClock      // Always CLOCK_REALTIME_COARSE
+        };
+
+        /**
+         * @brief Constructor.
+         * @param _source The time source.
+         * @param _tick Validity of a computed TOD. Zero means once per packet.
+         */
+        explicit TimeReference(Source _source = Source::PacketTimestamp,
+                               std::chrono::nanoseconds _tick = std::chrono::nanoseconds::zero()) noexcept
+            : source(_source), tickNs(_tick.count()) {}
+
+        void setSource(Source s) noexcept { source = s; valid = false; }
+
+        void setTick(std::chrono::nanoseconds tick) noexcept { tickNs = tick.count(); valid = false; }
+
+        /**
+         * @brief Marks the start of a new packet.
+         *
+         * With no tick the cached TOD is dropped. With a tick, it is kept as
+         * long as the packet timestamp stays within the tick following the
+         * packet it was computed for, whatever the source; packets without
+         * a timestamp, or stamped earlier (e.g. a replay rewind), drop it.
+         */
+        void beginPacket(const struct timespec& ts) noexcept {
+            packetTs = ts;
+            if (!valid) return;
+
+            const int64_t elapsed = toNanos(ts) - stampNs;
+            if (tickNs <= 0 || !hasTimestamp(ts) || elapsed < 0 || elapsed >= tickNs) {
+                valid = false;
+            }
+        }
+
+        /**
+         * @brief Forces the next call to currentTod() to recompute.
+         */
+        void invalidate() noexcept { valid = false; }
+
+        /**
+         * @brief Returns "now" in 1/128 s since midnight (UTC).
+         * Computed at most once per packet or tick.
+         */
+        [[nodiscard]] uint32_t currentTod() noexcept {
+            if (!valid) [[unlikely]] {
+                refresh();
+            }
+            return cachedTod;
+        }
+
+        /**
+         * @brief Converts a CLOCK_REALTIME timespec into ASTERIX TOD units.
+         */
+        [[nodiscard]] static uint32_t todFromTimespec(const struct timespec& ts) noexcept {
+            constexpr int64_t SECONDS_PER_DAY = 86400;
+            // 1 s = 128 units, so 1 unit = 7812500 ns
+            constexpr int64_t NANOS_PER_UNIT = 7812500;
+
+            const int64_t secOfDay = static_cast<int64_t>(ts.tv_sec) % SECONDS_PER_DAY;
+            return static_cast<uint32_t>(secOfDay * 128 + ts.tv_nsec / NANOS_PER_UNIT);
+        }
+
+        /**
+         * @brief Reads the coarse real-time clock and returns it in TOD units.
+         */
+        [[nodiscard]] static uint32_t systemTod() noexcept;
+
+    private:
+        static bool hasTimestamp(const struct timespec& ts) noexcept {
+            return ts.tv_sec != 0 || ts.tv_nsec != 0;
+        }
+
+        static int64_t toNanos(const struct timespec& ts) noexcept {
+            return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+        }
+
+        void refresh() noexcept;
+
+        Source source;
+        int64_t tickNs;
+
+        struct timespec packetTs{};
+
+        // Timestamp (ns) of the packet cachedTod was computed for, 0 if it
+        // had none; the tick is always measured on packet timestamps
+        int64_t stampNs{0};
+        uint32_t cachedTod{0};
+        bool valid{false};
+};
+
+} // namespace ReactorAsterix
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <cstdint>
+
+namespace ReactorAsterix::TruncatedTime {
+
+    /**
+     * @brief Expands a 16-bit truncated TOD (e.g. I001/141) to a full TOD.
+     *
+     * Picks, among the three 64K windows around the reference, the candidate
+     * closest to it on the 24h circle.
+     *
+     * @param truncated The 16 LSBs of the TOD (LSB = 1/128 s).
+     * @param reference A full TOD close to the expected result.
+     * @return The full TOD.
+     */
+    [[nodiscard]] uint32_t expand(uint16_t truncated, uint32_t reference) noexcept;
+
+} // namespace ReactorAsterix::TruncatedTime
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Inherits from
+#include <ReactorAsterix/cat001/IAsterix1Listener.h>
+#include <ReactorAsterix/cat002/IAsterix2Listener.h>
+
+// System headers
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+// Library headers
+#include <ReactorAsterix/export/ColumnarWriter.h>
+
+namespace ReactorAsterix::Export {
+
+/**
+ * @class Asterix1ColumnarExporter
+ * @brief Listener writing CAT001 plots to a columnar file.
+ *
+ * Rows are Asterix1CompactReport values, so columns keep the wire units
+ * (1/128 s, 1/128 NM, 360/2^16 deg, 1/4 FL) and the presence flags.
+ */
+class Asterix1ColumnarExporter final : public IAsterix1Listener {
+    public:
+        static constexpr uint32_t SCHEMA = 1;
+
+        explicit Asterix1ColumnarExporter(ColumnarWriterConfig config = {});
+
+        [[nodiscard]] int open(const std::string& path) { return writer.open(path); }
+
+        int close() { return writer.close(); }
+
+        void onReportDecoded(const Asterix1Report& report) override;
+
+        [[nodiscard]] ColumnarWriter& getWriter() noexcept { return writer; }
+
+    private:
+        ColumnarWriter writer;
+};
+
+/**
+ * @brief Row of a CAT002 columnar file.
+ */
+struct Asterix2ColumnRow {
+    enum Flags : uint8_t {
+        HAS_SECTOR = 0x01,  // I002/020
+        HAS_PERIOD = 0x02   // I002/041
+    };
+
+    uint32_t tod;
+    float    antennaSpeed;
+    uint16_t antennaPeriod;
+    uint8_t  sac;
+    uint8_t  sic;
+    uint8_t  messageType;
+    uint8_t  sectorNumber;
+    uint8_t  flags;
+};
+
+static_assert(std::is_trivially_copyable_v<Asterix2ColumnRow>);
+
+/**
+ * @class Asterix2ColumnarExporter
+ * @brief Listener writing CAT002 service messages to a columnar file.
+ */
+class Asterix2ColumnarExporter final : public IAsterix2Listener {
+    public:
+        static constexpr uint32_t SCHEMA = 2;
+
+        explicit Asterix2ColumnarExporter(ColumnarWriterConfig config = {});
+
+        [[nodiscard]] int open(const std::string& path) { return writer.open(path); }
+
+        int close() { return writer.close(); }
+
+        void onReportDecoded(const Asterix2Report& report) override;
+
+        [[nodiscard]] ColumnarWriter& getWriter() noexcept { return writer; }
+
+    private:
+        ColumnarWriter writer;
+};
+
+} // namespace ReactorAsterix::Export
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
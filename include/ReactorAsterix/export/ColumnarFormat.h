@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Columnar file layout (little endian).
+ *
+ *   Header:    magic "RAXCOL01" | version u32 | schema u32 | columns u32
+ *              then per column: type u8 | name length u8 | name
+ *   Row group: rows u32 | reserved u32
+ *              then per column: min f64 | max f64 | bytes u64
+ *              then the column arrays, in column order, each padded to 8 bytes
+ *   Footer:    per row group: offset u64 | rows u32 | reserved u32
+ *              then footer offset u64 | magic "RAXCOLFT"
+ *
+ * The footer lets readers locate every row group and skip those whose
+ * min/max statistics exclude a query.
+ */
+namespace ReactorAsterix::Export {
+
+    inline constexpr char COLUMNAR_MAGIC[8] = {'R', 'A', 'X', 'C', 'O', 'L', '0', '1'};
+    inline constexpr char FOOTER_MAGIC[8]   = {'R', 'A', 'X', 'C', 'O', 'L', 'F', 'T'};
+    inline constexpr uint32_t COLUMNAR_VERSION = 1;
+
+    inline constexpr size_t ROW_GROUP_HEADER_SIZE    = 8;
+    inline constexpr size_t COLUMN_CHUNK_HEADER_SIZE = 24;
+    inline constexpr size_t FOOTER_ENTRY_SIZE        = 16;
+    inline constexpr size_t FOOTER_TAIL_SIZE         = 16;
+
+    [[nodiscard]] constexpr size_t padTo8(size_t size) noexcept {
+        return (size + 7) & ~size_t{7};
+    }
+
+    enum class ColumnType : uint8_t {
+        U8  = 1,
+        I16 = 2,
+        U16 = 3,
+        U32 = 4,
+        F32 = 5
+    };
+
+    [[nodiscard]] constexpr size_t columnTypeSize(ColumnType type) noexcept {
+        switch (type) {
+            case ColumnType::U8:  return 1;
+            case ColumnType::I16: return 2;
+            case ColumnType::U16: return 2;
+            case ColumnType::U32: return 4;
+            case ColumnType::F32: return 4;
+        }
+        return 0;
+    }
+
+} // namespace ReactorAsterix::Export
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
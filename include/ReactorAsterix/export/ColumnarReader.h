@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Library headers
+#include <ReactorAsterix/export/ColumnarFormat.h>
+
+namespace ReactorAsterix::Export {
+
+/**
+ * @brief Min/max statistics of one column in one row group.
+ */
+struct ColumnStats {
+    double min{0.0};
+    double max{0.0};
+};
+
+/**
+ * @class ColumnarReader
+ * @brief Reads files written by ColumnarWriter, one column chunk at a time.
+ *
+ * open() only reads the header and the footer; row group headers are read
+ * on demand, so a query touching two columns reads only those two arrays.
+ */
+class ColumnarReader {
+    public:
+        struct Column {
+            std::string name;
+            ColumnType type;
+        };
+
+        ColumnarReader() = default;
+        ~ColumnarReader();
+
+        ColumnarReader(const ColumnarReader&) = delete;
+        ColumnarReader& operator=(const ColumnarReader&) = delete;
+
+        /**
+         * @return 0 on success, an errno value otherwise (EBADMSG for a
+         * foreign or unfinished file).
+         */
+        [[nodiscard]] int open(const std::string& path);
+
+        void close() noexcept;
+
+        [[nodiscard]] uint32_t schema() const noexcept { return schemaId; }
+
+        [[nodiscard]] const std::vector<Column>& columns() const noexcept { return columnList; }
+
+        /**
+         * @return The index of the column called 'name', or -1.
+         */
+        [[nodiscard]] int findColumn(const std::string& name) const noexcept;
+
+        [[nodiscard]] size_t rowGroupCount() const noexcept { return groups.size(); }
+
+        [[nodiscard]] uint32_t rowCount(size_t group) const noexcept { return groups[group].rows; }
+
+        /**
+         * @brief Statistics of a column chunk.
+         * @return 0 on success, an errno value otherwise.
+         */
+        [[nodiscard]] int stats(size_t group, size_t column, ColumnStats& out);
+
+        /**
+         * @brief Reads the raw array of a column chunk.
+         * @return 0 on success, an errno value otherwise.
+         */
+        [[nodiscard]] int readColumn(size_t group, size_t column, std::vector<uint8_t>& out);
+
+        /**
+         * @brief Reads a column chunk as values of type T (matching its ColumnType).
+         * @return 0 on success, an errno value otherwise (EINVAL on a type mismatch).
+         */
+        template <typename T>
+        [[nodiscard]] int readColumn(size_t group, size_t column, std::vector<T>& out) {
+            if (column >= columnList.size() || columnTypeSize(columnList[column].type) != sizeof(T)) {
+                return EINVAL;
+            }
+            const int err = readColumn(group, column, raw);
+            if (err != 0) return err;
+
+            out.resize(raw.size() / sizeof(T));
+            std::memcpy(out.data(), raw.data(), out.size() * sizeof(T));
+            return 0;
+        }
+
+    private:
+        struct ChunkInfo {
+            ColumnStats stats;
+            uint64_t offset;
+            uint64_t bytes;
+        };
+
+        struct GroupInfo {
+            uint64_t offset;
+            uint32_t rows;
+            bool loaded{false};
+            std::vector<ChunkInfo> chunks;
+        };
+
+        int loadGroup(GroupInfo& group);
+
+        int fd{-1};
+        uint32_t schemaId{0};
+        std::vector<Column> columnList;
+        std::vector<GroupInfo> groups;
+        std::vector<uint8_t> raw;
+};
+
+} // namespace ReactorAsterix::Export
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Library headers
+#include <ReactorAsterix/export/ColumnarFormat.h>
+
+namespace ReactorAsterix::Export {
+
+/**
+ * @brief A column and where its value lives in a row.
+ */
+struct ColumnDef {
+    std::string name;
+    ColumnType type;
+    size_t offset;      // Byte offset of the field in the row struct
+};
+
+/**
+ * @brief Settings of a ColumnarWriter.
+ */
+struct ColumnarWriterConfig {
+    size_t rowGroupRows{1 << 16};     // Rows per row group
+    size_t maxPendingGroups{4};       // Filled groups waiting for the writer thread
+    bool dropWhenBusy{false};         // Drop rows instead of waiting for the writer thread
+};
+
+/**
+ * @brief Copyable writer counters.
+ */
+struct ColumnarWriterStats {
+    uint64_t rows{0};
+    uint64_t rowGroups{0};
+    uint64_t droppedRows{0};
+    uint64_t writeErrors{0};
+};
+
+/**
+ * @class ColumnarWriter
+ * @brief Collects fixed-size rows and writes them as columnar row groups.
+ *
+ * append() only copies the row into the current group. Full groups are
+ * handed to a background thread, which transposes them into per-column
+ * arrays, computes min/max statistics and writes them out.
+ *
+ * Not thread-safe: append() and flush() are called from one thread.
+ */
+class ColumnarWriter {
+    public:
+        /**
+         * @brief Constructor.
+         * @param schema Identifies the row layout in the file header.
+         * @param rowSize Size of one row struct.
+         * @param columns The columns, in file order.
+         */
+        ColumnarWriter(uint32_t schema, size_t rowSize, std::vector<ColumnDef> columns,
+                       ColumnarWriterConfig config = {});
+        ~ColumnarWriter();
+
+        ColumnarWriter(const ColumnarWriter&) = delete;
+        ColumnarWriter& operator=(const ColumnarWriter&) = delete;
+
+        /**
+         * @brief Creates (or truncates) 'path' and starts the writer thread.
+         * @return 0 on success, an errno value otherwise.
+         */
+        [[nodiscard]] int open(const std::string& path);
+
+        /**
+         * @brief Appends one row of rowSize bytes.
+         */
+        void append(const void* row);
+
+        /**
+         * @brief Hands the partial row group to the writer thread.
+         */
+        void flush();
+
+        /**
+         * @brief Writes the pending groups and the footer, then closes the file.
+         * @return 0 on success, an errno value otherwise.
+         */
+        int close();
+
+        [[nodiscard]] const std::vector<ColumnDef>& columns() const noexcept { return columnDefs; }
+
+        [[nodiscard]] ColumnarWriterStats getStats() const noexcept;
+
+    private:
+        struct Group {
+            std::vector<uint8_t> rows;
+            size_t count{0};
+        };
+
+        void run();
+        void writeGroup(const Group& group);
+        bool writeAll(const void* bytes, size_t size);
+
+        const uint32_t schema;
+        const size_t rowSize;
+        const std::vector<ColumnDef> columnDefs;
+        ColumnarWriterConfig config;
+
+        int fd{-1};
+        uint64_t fileOffset{0};
+
+        // Decode thread side
+        Group current;
+
+        // Shared with the writer thread
+        std::mutex mutex;
+        std::condition_variable wakeWriter;
+        std::condition_variable wakeProducer;
+        std::vector<Group> filled;
+        std::vector<Group> spare;
+        bool stopping{false};
+        std::thread writer;
+
+        // Writer thread side
+        std::vector<uint8_t> columnBuffer;
+        std::vector<uint8_t> footer;
+
+        std::atomic<uint64_t> rows{0};
+        std::atomic<uint64_t> rowGroups{0};
+        std::atomic<uint64_t> droppedRows{0};
+        std::atomic<uint64_t> writeErrors{0};
+};
+
+} // namespace ReactorAsterix::Export
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <cstddef>
+#include <memory>
+
+namespace ReactorAsterix {
+    class Asterix1Report;
+    class Asterix2Report;
+}
+
+namespace ReactorAsterix::Export {
+
+/**
+ * @class NdjsonSerializer
+ * @brief Formats decoded reports as NDJSON lines into a preallocated buffer.
+ *
+ * Numbers are formatted with std::to_chars, strings never need escaping
+ * and nothing is allocated after construction, so a line costs a few
+ * hundred nanoseconds. Optional items are emitted only when present.
+ *
+ * CAT001 line:
+ *   {"cat":1,"sac":1,"sic":2,"tod":12.5,"ssrpsr":2,"ds1ds2":0,"spi":false,
+ *    "range":1234.56,"azimuth":0.785398,"mode3A":"7777","mode3AV":true,
+ *    "mode3AG":false,"mode3AL":false,"height":3048.00,"heightV":true,
+ *    "heightG":false,"todLSP":1600}
+ *
+ * CAT002 line:
+ *   {"cat":2,"sac":1,"sic":2,"tod":12.5,"type":2,"sector":32,
+ *    "period":512,"speed":1.5}
+ *
+ * Units: tod in seconds, range and height in meters, azimuth in radians,
+ * antenna period as received (1/128 s).
+ *
+ * Not thread-safe: use one serializer per thread.
+ */
+class NdjsonSerializer {
+    public:
+        // Upper bound of one line, newline included
+        static constexpr size_t MAX_LINE_SIZE = 384;
+
+        /**
+         * @param capacity Buffer size; at least MAX_LINE_SIZE.
+         */
+        explicit NdjsonSerializer(size_t capacity = 1 << 20);
+
+        /**
+         * @brief Appends one line.
+         * @return false if the buffer is full (flush and retry) or a value
+         * cannot be formatted; the buffer is left unchanged.
+         */
+        bool append(const Asterix1Report& report) noexcept;
+        bool append(const Asterix2Report& report) noexcept;
+
+        /**
+         * @brief Writes the buffered lines to 'fd' and empties the buffer.
+         * @return 0 on success, an errno value otherwise.
+         */
+        [[nodiscard]] int flushTo(int fd) noexcept;
+
+        [[nodiscard]] const char* data() const noexcept { return buffer.get(); }
+        [[nodiscard]] size_t size() const noexcept { return used; }
+        [[nodiscard]] size_t capacity() const noexcept { return bufferSize; }
+
+        void clear() noexcept { used = 0; }
+
+        /**
+         * @brief Formats one line into 'out'.
+         * @return The number of characters written, 0 if 'size' is too small.
+         */
+        static size_t format(const Asterix1Report& report, char* out, size_t size) noexcept;
+        static size_t format(const Asterix2Report& report, char* out, size_t size) noexcept;
+
+    private:
+        size_t bufferSize;
+        std::unique_ptr<char[]> buffer;
+        size_t used{0};
+};
+
+} // namespace ReactorAsterix::Export
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sys/socket.h>
+#include <vector>
+
+// Library headers
+#include <ReactorAsterix/core/AsterixPacketHandler.h>
+
+namespace ReactorAsterix::Net {
+
+/**
+ * @class DatagramBatch
+ * @brief Preallocated buffers for one recvmmsg() call.
+ *
+ * All payload buffers live in one contiguous allocation; headers, iovecs
+ * and control buffers are set up once and only msg_len/msg_controllen are
+ * refreshed between calls. The batch can be shared by several sockets
+ * served from the same thread.
+ */
+class DatagramBatch {
+    public:
+        /**
+         * @brief Constructor.
+         * @param capacity Maximum datagrams per call.
+         * @param bufferSize Bytes reserved per datagram; larger ones are truncated.
+         */
+        DatagramBatch(size_t capacity, size_t bufferSize);
+
+        DatagramBatch(const DatagramBatch&) = delete;
+        DatagramBatch& operator=(const DatagramBatch&) = delete;
+
+        /**
+         * @brief Receives up to capacity() datagrams from 'fd'.
+         *
+         * Truncated datagrams are dropped from the batch and counted.
+         *
+         * @param fd The socket.
+         * @param flags recvmmsg() flags, e.g. MSG_DONTWAIT or MSG_WAITFORONE.
+         * @return The number of datagrams available, or -errno.
+         */
+        int receive(int fd, int flags);
+
+        /**
+         * @brief The datagrams of the last receive(), with kernel timestamps
+         * when SO_TIMESTAMPNS is enabled on the socket.
+         */
+        [[nodiscard]] const AsterixDatagram* datagrams() const noexcept { return views.data(); }
+
+        [[nodiscard]] size_t capacity() const noexcept { return headers.size(); }
+
+        /**
+         * @brief Number of datagrams dropped because they did not fit.
+         */
+        [[nodiscard]] uint64_t truncatedCount() const noexcept {
+            return truncated.load(std::memory_order_relaxed);
+        }
+
+    private:
+        size_t bufferSize;
+
+        std::unique_ptr<uint8_t[]> payload;
+        std::unique_ptr<uint8_t[]> control;
+
+        std::vector<struct mmsghdr> headers;
+        std::vector<struct iovec> iovecs;
+        std::vector<AsterixDatagram> views;
+
+        // Updated by the receiving thread only
+        std::atomic<uint64_t> truncated{0};
+};
+
+} // namespace ReactorAsterix::Net
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
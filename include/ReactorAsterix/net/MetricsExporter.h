@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Library headers
+#include <ReactorAsterix/core/AsterixPacketHandler.h>
+
+namespace ReactorAsterix::Net {
+
+/**
+ * @brief Settings of a MetricsExporter.
+ */
+struct MetricsExporterConfig {
+    std::string bindAddress{"127.0.0.1"};
+    uint16_t port{9464};               // 0 picks a free port
+    std::string path{"/metrics"};
+    int ioTimeoutMs{1000};             // Per scrape connection
+};
+
+/**
+ * @class MetricsExporter
+ * @brief Serves decoder statistics in OpenMetrics text format over HTTP/1.1.
+ *
+ * A single background thread accepts one scrape at a time and renders the
+ * snapshots of the registered handlers: global counters, per-category
+ * counters, per-source counters and latency histograms when enabled.
+ * Snapshots only read relaxed atomics, so a scrape never blocks or slows
+ * the decoding threads.
+ *
+ * Register handlers before start(); they must outlive the exporter.
+ */
+class MetricsExporter {
+    public:
+        explicit MetricsExporter(MetricsExporterConfig config = {});
+        ~MetricsExporter();
+
+        MetricsExporter(const MetricsExporter&) = delete;
+        MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+        /**
+         * @brief Exposes 'handler' with the label handler="<label>".
+         */
+        void addHandler(const AsterixPacketHandler& handler, std::string label);
+
+        /**
+         * @brief Binds the listening socket and starts the serving thread.
+         * @return 0 on success, an errno value otherwise.
+         */
+        [[nodiscard]] int start();
+
+        /**
+         * @brief Stops and joins the serving thread and closes the socket.
+         */
+        void stop();
+
+        /**
+         * @brief The bound port, useful when the configured port is 0.
+         */
+        [[nodiscard]] uint16_t localPort() const noexcept;
+
+        /**
+         * @brief The exposition text served on each scrape.
+         */
+        [[nodiscard]] std::string render() const;
+
+        [[nodiscard]] uint64_t scrapes() const noexcept { return scrapeCount.load(std::memory_order_relaxed); }
+
+    private:
+        struct Source {
+            const AsterixPacketHandler* handler;
+            std::string label;      // Already escaped
+        };
+
+        void run();
+        void serve(int client);
+
+        MetricsExporterConfig config;
+        std::vector<Source> sources;
+
+        int listenFd{-1};
+        int stopFd{-1};
+        std::thread thread;
+        std::atomic<uint64_t> scrapeCount{0};
+};
+
+} // namespace ReactorAsterix::Net
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <atomic>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Library headers
+#include <ReactorAsterix/core/AsterixPacketHandler.h>
+#include <ReactorAsterix/net/DatagramBatch.h>
+
+namespace ReactorAsterix::Net {
+
+/**
+ * @brief One group/port joined by a MulticastReceiver.
+ */
+struct MulticastSubscription {
+    std::string group;                        // Multicast group; a unicast address is just bound
+    uint16_t port{0};
+    std::string interfaceAddress{"0.0.0.0"};  // Local interface used for the join
+    AsterixPacketHandler* handler{nullptr};   // Not owned, may be shared by subscriptions
+    std::bitset<256> categories{};            // Categories to decode; none set means all
+};
+
+/**
+ * @brief Settings shared by all sockets of a MulticastReceiver.
+ */
+struct MulticastReceiverConfig {
+    size_t batchSize{64};         // Datagrams per recvmmsg()
+    size_t bufferSize{8192};      // Bytes per datagram
+    int receiveBufferBytes{0};    // SO_RCVBUF, 0 keeps the system default
+    int pollTimeoutMs{100};       // How long poll() waits for a ready socket
+    bool kernelTimestamps{true};  // SO_TIMESTAMPNS
+};
+
+/**
+ * @brief Copyable counters of one subscription.
+ */
+struct MulticastSubscriptionStats {
+    uint64_t datagrams{0};
+    uint64_t filteredBlocks{0};      // Blocks skipped by the category filter
+    uint64_t filteredDatagrams{0};   // Datagrams left without a block, not passed to the handler
+    uint64_t errors{0};
+};
+
+/**
+ * @class MulticastReceiver
+ * @brief Serves many multicast groups and ports from one thread.
+ *
+ * Every subscription has its own socket, registered in one epoll set. Ready
+ * sockets are drained with recvmmsg() into a single shared DatagramBatch
+ * and the datagrams are handed to the subscription's handler, after
+ * dropping the data blocks whose category is not selected.
+ *
+ * Not thread-safe: subscribe(), poll() and run() are called from one thread.
+ */
+class MulticastReceiver {
+    public:
+        explicit MulticastReceiver(MulticastReceiverConfig config = {});
+        ~MulticastReceiver();
+
+        MulticastReceiver(const MulticastReceiver&) = delete;
+        MulticastReceiver& operator=(const MulticastReceiver&) = delete;
+
+        /**
+         * @brief Opens a socket for 'subscription' and joins its group.
+         * @return The subscription index, or -errno.
+         */
+        [[nodiscard]] int subscribe(const MulticastSubscription& subscription);
+
+        /**
+         * @brief Waits up to pollTimeoutMs and drains every ready socket.
+         * @return The number of datagrams processed, 0 on timeout, -errno on error.
+         */
+        int poll();
+
+        /**
+         * @brief Processes datagrams until 'stop' becomes true.
+         */
+        void run(const std::atomic<bool>& stop);
+
+        [[nodiscard]] size_t subscriptionCount() const noexcept { return subscriptions.size(); }
+
+        /**
+         * @brief The bound port of a subscription, useful when its port is 0.
+         */
+        [[nodiscard]] uint16_t localPort(size_t index) const noexcept;
+
+        [[nodiscard]] MulticastSubscriptionStats getStats(size_t index) const noexcept;
+
+    private:
+        struct Subscription {
+            int sock{-1};
+            AsterixPacketHandler* handler{nullptr};
+            std::bitset<256> categories;
+            bool filtered{false};
+
+            std::atomic<uint64_t> datagrams{0};
+            std::atomic<uint64_t> filteredBlocks{0};
+            std::atomic<uint64_t> filteredDatagrams{0};
+            std::atomic<uint64_t> errors{0};
+        };
+
+        int drain(Subscription& subscription);
+        void dispatch(Subscription& subscription, int count);
+
+        MulticastReceiverConfig config;
+        DatagramBatch batch;
+        int epollFd{-1};
+
+        std::vector<std::unique_ptr<Subscription>> subscriptions;
+
+        // One entry per filtered datagram that keeps a block, reused between batches
+        std::vector<AsterixDatagram> selected;
+
+        // Selected blocks that were not contiguous, copied together; sized
+        // for a whole batch so the views into it stay valid
+        std::vector<uint8_t> compacted;
+};
+
+} // namespace ReactorAsterix::Net
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Library headers
+#include <ReactorAsterix/core/AsterixDiagnostics.h>
+#include <ReactorAsterix/core/AsterixPacketHandler.h>
+#include <ReactorAsterix/net/UdpReceiver.h>
+
+namespace ReactorAsterix::Net {
+
+/**
+ * @brief Settings of a ReusePortReceiverGroup.
+ */
+struct ReusePortGroupConfig {
+    UdpReceiverConfig receiver{};  // Shared by all sockets; reusePort is forced on
+    size_t instances{0};           // 0 uses one instance per online CPU
+    std::vector<int> cpus{};       // CPU of instance i; empty pins instance i to CPU i
+    bool pinThreads{true};
+};
+
+/**
+ * @class ReusePortReceiverGroup
+ * @brief N SO_REUSEPORT sockets on one port, one thread and one
+ * AsterixPacketHandler each.
+ *
+ * The kernel spreads flows (source address/port) over the sockets, so every
+ * radar feed is decoded entirely on one core with no cross-thread handoff.
+ * Each instance has its own handler set, built by the setup callback;
+ * listeners shared between instances must therefore be thread-safe.
+ */
+class ReusePortReceiverGroup {
+    public:
+        /**
+         * @brief Registers the category handlers and listeners of one instance.
+         * Called from start(), before the instance thread runs.
+         */
+        using HandlerSetup = std::function<void(AsterixPacketHandler& handler, size_t index)>;
+
+        ReusePortReceiverGroup(ReusePortGroupConfig config, HandlerSetup setup);
+        ~ReusePortReceiverGroup();
+
+        ReusePortReceiverGroup(const ReusePortReceiverGroup&) = delete;
+        ReusePortReceiverGroup& operator=(const ReusePortReceiverGroup&) = delete;
+
+        /**
+         * @brief Opens all sockets, then starts one receiving thread per socket.
+         * @return 0 on success, an errno value otherwise (nothing is left running),
+         * EINVAL when the receiver pollTimeoutMs is not positive.
+         */
+        [[nodiscard]] int start();
+
+        /**
+         * @brief Stops and joins the threads and closes the sockets.
+         */
+        void stop();
+
+        [[nodiscard]] size_t size() const noexcept { return instances.size(); }
+
+        [[nodiscard]] AsterixPacketHandler& handler(size_t index) { return *instances[index]->handler; }
+
+        /**
+         * @brief The shared port, useful when the configured port is 0.
+         */
+        [[nodiscard]] uint16_t localPort() const noexcept;
+
+        /**
+         * @brief Number of threads that could not be pinned to their CPU.
+         */
+        [[nodiscard]] size_t unpinnedCount() const noexcept {
+            return unpinned.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Decoder counters summed over all instances.
+         */
+        [[nodiscard]] AsterixStatsData getStatsSnapshot() const;
+
+        /**
+         * @brief Latency histograms merged over all instances (see
+         * AsterixPacketHandler::enableLatencyHistograms()).
+         */
+        [[nodiscard]] AsterixLatencyData getLatencySnapshot() const;
+
+        /**
+         * @brief Receiver counters summed over all instances: failed is the
+         * number of instances whose thread stopped on a socket error.
+         */
+        [[nodiscard]] UdpReceiverStats getReceiverStats() const;
+
+    private:
+        struct Instance {
+            std::unique_ptr<AsterixPacketHandler> handler;
+            std::unique_ptr<UdpReceiver> receiver;
+            std::thread thread;
+            int cpu{-1};
+        };
+
+        void runInstance(Instance& instance);
+
+        ReusePortGroupConfig config;
+        HandlerSetup setup;
+
+        std::vector<std::unique_ptr<Instance>> instances;
+        std::atomic<bool> stopping{false};
+        std::atomic<size_t> unpinned{0};
+};
+
+} // namespace ReactorAsterix::Net
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
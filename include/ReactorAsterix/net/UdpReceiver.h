@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Library headers
+#include <ReactorAsterix/core/AsterixPacketHandler.h>
+#include <ReactorAsterix/net/DatagramBatch.h>
+
+namespace ReactorAsterix::Net {
+
+/**
+ * @brief Settings of a UdpReceiver.
+ */
+struct UdpReceiverConfig {
+    std::string bindAddress{"0.0.0.0"};
+    uint16_t port{0};             // 0 picks an ephemeral port (see localPort())
+    size_t batchSize{64};         // Datagrams per recvmmsg()
+    size_t bufferSize{8192};      // Bytes per datagram
+    int receiveBufferBytes{0};    // SO_RCVBUF, 0 keeps the system default
+    int pollTimeoutMs{100};       // How long poll() waits for the first datagram, must be positive
+    bool kernelTimestamps{true};  // SO_TIMESTAMPNS
+    bool reusePort{false};        // SO_REUSEPORT
+    bool reuseAddress{false};     // SO_REUSEADDR, lets several multicast sockets share a port
+};
+
+/**
+ * @brief Copyable receiver counters.
+ */
+struct UdpReceiverStats {
+    uint64_t datagrams{0};
+    uint64_t batches{0};
+    uint64_t truncated{0};
+    uint64_t errors{0};
+    uint64_t failed{0};           // 1 once run() has stopped on a socket error
+};
+
+/**
+ * @class UdpReceiver
+ * @brief Standalone UDP ingestion feeding an AsterixPacketHandler.
+ *
+ * Uses recvmmsg() with preallocated buffers and kernel receive timestamps,
+ * and hands every batch to AsterixPacketHandler::handlePackets(). Does not
+ * depend on the AtuReactor event loop.
+ *
+ * Not thread-safe: poll()/run() are called from one thread.
+ */
+class UdpReceiver {
+    public:
+        UdpReceiver(AsterixPacketHandler& handler, UdpReceiverConfig config = {});
+        ~UdpReceiver();
+
+        UdpReceiver(const UdpReceiver&) = delete;
+        UdpReceiver& operator=(const UdpReceiver&) = delete;
+
+        /**
+         * @brief Creates and binds the socket.
+         * @return 0 on success, an errno value otherwise (EINVAL when
+         * pollTimeoutMs is not positive).
+         */
+        [[nodiscard]] int open();
+
+        /**
+         * @brief Closes the socket (also done by the destructor).
+         */
+        void close() noexcept;
+
+        /**
+         * @brief Waits up to pollTimeoutMs for datagrams and processes one batch.
+         * @return The number of datagrams processed, 0 on timeout, -errno on error.
+         */
+        int poll();
+
+        /**
+         * @brief Processes batches until 'stop' becomes true.
+         *
+         * Returns early on a socket error, which is counted in errors and
+         * sets failed in the stats until the next open().
+         */
+        void run(const std::atomic<bool>& stop);
+
+        /**
+         * @brief The bound port, useful when the configured port is 0.
+         */
+        [[nodiscard]] uint16_t localPort() const noexcept;
+
+        [[nodiscard]] int fd() const noexcept { return sock; }
+
+        [[nodiscard]] UdpReceiverStats getStats() const noexcept;
+
+    private:
+        AsterixPacketHandler& handler;
+        UdpReceiverConfig config;
+
+        DatagramBatch batch;
+        int sock{-1};
+
+        // Written by the receiving thread, read by getStats()
+        std::atomic<uint64_t> datagrams{0};
+        std::atomic<uint64_t> batches{0};
+        std::atomic<uint64_t> errors{0};
+        std::atomic<uint64_t> failed{0};
+};
+
+/**
+ * @brief Opens a UDP socket configured as in 'config', bound to
+ * config.bindAddress:config.port.
+ * @return The socket, or -errno.
+ */
+[[nodiscard]] int openUdpSocket(const UdpReceiverConfig& config);
+
+} // namespace ReactorAsterix::Net
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
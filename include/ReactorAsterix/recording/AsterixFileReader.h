@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// Library headers
+#include <ReactorAsterix/core/AsterixPacketHandler.h>
+
+namespace ReactorAsterix::Recording {
+
+/**
+ * @brief Layouts of ASTERIX files exchanged between centres.
+ */
+enum class FileFraming {
+    AUTO,       // Detected by open()
+    RAW,        // Concatenated data blocks, no timestamps
+    FINAL,      // FINAL recorder framing, see FramingSpec::finalPreset()
+    IOSS,       // IOSS framing, see FramingSpec::iossPreset()
+    CUSTOM      // AsterixFileReaderConfig::custom
+};
+
+/**
+ * @brief Description of a length-prefixed record framing.
+ *
+ * A record is a header, the ASTERIX data (one or more blocks) and an
+ * optional trailer. The header holds the record length and, optionally, the
+ * recording time of day.
+ */
+struct FramingSpec {
+    size_t headerSize{0};
+    size_t trailerSize{0};
+
+    size_t lengthOffset{0};
+    size_t lengthSize{2};             // 1 to 4 bytes
+    bool lengthBigEndian{true};
+    bool lengthIncludesFraming{true}; // Length counts header and trailer too
+
+    size_t timeOffset{0};
+    size_t timeSize{0};               // 0: no time field
+    bool timeBigEndian{true};
+    uint64_t timeUnitNs{10'000'000};  // Time of day resolution
+
+    uint8_t trailerByte{0};           // Expected padding value, checked by detection
+    bool checkTrailer{false};
+
+    /**
+     * @brief FINAL: byte count (2, BE, whole record) | board | line |
+     * recording day | time of day (3, BE, 10 ms) | data | 4 x 0xA5.
+     */
+    [[nodiscard]] static FramingSpec finalPreset() noexcept;
+
+    /**
+     * @brief IOSS: byte count (2, LE, whole record) | queue | line |
+     * time of day (4, LE, 10 ms) | data.
+     */
+    [[nodiscard]] static FramingSpec iossPreset() noexcept;
+};
+
+/**
+ * @brief Settings of an AsterixFileReader.
+ */
+struct AsterixFileReaderConfig {
+    FileFraming framing{FileFraming::AUTO};
+    FramingSpec custom{};             // Used with FileFraming::CUSTOM
+    size_t chunkSize{4 << 20};        // Bytes per read()
+    bool useMmap{false};              // Map the whole file instead of reading it
+};
+
+/**
+ * @brief Copyable reader counters.
+ */
+struct AsterixFileReaderStats {
+    uint64_t records{0};
+    uint64_t bytes{0};                // ASTERIX bytes handed out
+    uint64_t truncatedTail{0};        // Bytes of an incomplete last record
+};
+
+/**
+ * @class AsterixFileReader
+ * @brief Streams the ASTERIX data of a raw, FINAL, IOSS or custom framed file.
+ *
+ * Records are handed out as views into the read buffer (or the mapping), so
+ * nothing is copied except the few bytes of a record cut by the end of a
+ * read, which are moved in front of the next one. Timestamps carry the
+ * time of day of the framing, when it has one, as seconds since midnight.
+ *
+ * Not thread-safe.
+ */
+class AsterixFileReader {
+    public:
+        explicit AsterixFileReader(AsterixFileReaderConfig config = {});
+        ~AsterixFileReader();
+
+        AsterixFileReader(const AsterixFileReader&) = delete;
+        AsterixFileReader& operator=(const AsterixFileReader&) = delete;
+
+        /**
+         * @brief Opens 'path' and, with FileFraming::AUTO, detects its framing.
+         * @return 0 on success, an errno value otherwise (EBADMSG if the
+         * framing is not recognized).
+         */
+        [[nodiscard]] int open(const std::string& path);
+
+        void close() noexcept;
+
+        /**
+         * @brief Reads the next record (RAW: the next data block).
+         *
+         * 'out' stays valid until the next call.
+         *
+         * @return 1 if a record was read, 0 at the end of the file, -errno on
+         * error (-EBADMSG for a corrupt record).
+         */
+        int next(AsterixDatagram& out);
+
+        /**
+         * @brief Feeds every remaining record to 'handler'.
+         * @return The number of records, or -errno.
+         */
+        int64_t feed(AsterixPacketHandler& handler);
+
+        [[nodiscard]] FileFraming framing() const noexcept { return detected; }
+
+        [[nodiscard]] const AsterixFileReaderStats& getStats() const noexcept { return stats; }
+
+    private:
+        const uint8_t* ensure(size_t count);
+        FileFraming detect();
+
+        AsterixFileReaderConfig config;
+
+        int fd{-1};
+        FileFraming detected{FileFraming::AUTO};
+        FramingSpec spec{};
+
+        // Read buffer, or the whole file when mapped
+        std::unique_ptr<uint8_t[]> buffer;
+        const uint8_t* data{nullptr};
+        size_t mappedSize{0};
+        size_t pos{0};
+        size_t end{0};
+        bool eof{false};
+        int readError{0};
+
+        AsterixFileReaderStats stats{};
+};
+
+} // namespace ReactorAsterix::Recording
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
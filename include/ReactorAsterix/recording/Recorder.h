@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Library headers
+#include <ReactorAsterix/core/AsterixPacketHandler.h>
+
+namespace ReactorAsterix::Recording {
+
+namespace detail {
+    class WriteBackend;
+}
+
+/**
+ * @brief Settings of a Recorder.
+ */
+struct RecorderConfig {
+    size_t bufferSize{1 << 20};   // Bytes per write buffer (at least one full frame)
+    size_t bufferCount{4};        // Buffers in flight plus the one being filled
+    bool useIoUring{true};        // Ignored when built without liburing
+    bool dropWhenBusy{false};     // Drop frames instead of waiting for the disk
+
+    bool writeIndex{true};                        // Maintain "<path>.idx"
+    uint64_t indexIntervalNs{1'000'000'000};      // One entry per period of receive time...
+    uint64_t indexIntervalBytes{64ULL << 20};     // ...or per this many bytes of recording
+};
+
+/**
+ * @brief Copyable recorder counters.
+ */
+struct RecorderStats {
+    uint64_t frames{0};
+    uint64_t bytes{0};            // Datagram bytes, frame headers excluded
+    uint64_t dropped{0};          // Oversized, or no free buffer with dropWhenBusy
+    uint64_t writes{0};           // Buffers submitted to the kernel
+    uint64_t writeErrors{0};
+};
+
+/**
+ * @class Recorder
+ * @brief Appends received datagrams and their timestamps to a recording file.
+ *
+ * Frames are copied into large preallocated buffers; a full buffer is handed
+ * to the kernel as one write while the next one is being filled, so the
+ * receive thread never waits on the disk unless every buffer is in flight.
+ *
+ * With liburing the buffers are registered with the ring and written with
+ * IORING_OP_WRITE_FIXED. Otherwise, or when the ring cannot be set up, a
+ * background thread issues pwrite() calls.
+ *
+ * Not thread-safe: record() and flush() are called from one thread; the
+ * counters may be read from any thread.
+ */
+class Recorder {
+    public:
+        explicit Recorder(RecorderConfig config = {});
+        ~Recorder();
+
+        Recorder(const Recorder&) = delete;
+        Recorder& operator=(const Recorder&) = delete;
+
+        /**
+         * @brief Creates (or truncates) 'path' and writes the file header,
+         * along with the time index when enabled.
+         * @return 0 on success, an errno value otherwise.
+         */
+        [[nodiscard]] int open(const std::string& path);
+
+        /**
+         * @brief Appends one datagram.
+         * @return false if the frame was dropped.
+         */
+        bool record(const uint8_t data[], size_t size, const struct timespec& ts);
+
+        /**
+         * @brief Appends a receive batch, e.g. from a DatagramBatch.
+         */
+        void record(const AsterixDatagram datagrams[], size_t count);
+
+        /**
+         * @brief Submits the partially filled buffer.
+         */
+        void flush();
+
+        /**
+         * @brief Flushes, waits for all pending writes and closes the file.
+         * @return 0 on success, an errno value otherwise.
+         */
+        int close();
+
+        [[nodiscard]] bool isOpen() const noexcept { return fd >= 0; }
+
+        /**
+         * @brief Whether writes currently go through io_uring.
+         */
+        [[nodiscard]] bool usingIoUring() const noexcept;
+
+        /**
+         * @brief File size once every submitted buffer has been written.
+         */
+        [[nodiscard]] uint64_t fileSize() const noexcept { return fileOffset + activeUsed; }
+
+        [[nodiscard]] RecorderStats getStats() const noexcept;
+
+    private:
+        bool nextBuffer();
+        void reap(bool wait);
+
+        RecorderConfig config;
+
+        int fd{-1};
+        std::unique_ptr<uint8_t[]> storage;
+        std::vector<size_t> freeBuffers;
+        std::unique_ptr<detail::WriteBackend> backend;
+
+        size_t active{0};
+        size_t activeUsed{0};
+        uint64_t fileOffset{0};
+
+        // Index entries are written along with the buffer holding their
+        // frames, from an area of 64 entries per buffer
+        static constexpr size_t INDEX_BYTES_PER_BUFFER = 64 * 16;
+
+        int indexFd{-1};
+        std::unique_ptr<uint8_t[]> indexStorage;
+        size_t indexUsed{0};
+        uint64_t indexOffset{0};
+        uint64_t nextIndexNanos{0};
+        uint64_t lastIndexedNanos{0};
+        uint64_t lastIndexedFrame{0};
+
+        // Written by the recording thread, read by getStats()
+        std::atomic<uint64_t> frames{0};
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> writes{0};
+        std::atomic<uint64_t> writeErrors{0};
+};
+
+} // namespace ReactorAsterix::Recording
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <string>
+
+/**
+ * @brief On-disk layout of a datagram recording.
+ *
+ * A recording is a 16-byte file header followed by frames, each made of a
+ * 12-byte frame header and the datagram bytes. All integers are little
+ * endian.
+ *
+ *   File header:  magic "RAXREC01" (8) | version u32 | reserved u32
+ *   Frame header: receive time u64 (ns since the epoch) | length u32
+ *
+ * A sparse time index is written alongside ("<recording>.idx"): a 16-byte
+ * header followed by entries pointing at the first frame of every indexed
+ * period, in recording order. Entry times never decrease, even when the
+ * receive clock steps back.
+ *
+ *   Index header: magic "RAXIDX01" (8) | version u32 | reserved u32
+ *   Index entry:  receive time u64 | frame offset u64
+ */
+namespace ReactorAsterix::Recording {
+
+    inline constexpr char MAGIC[8] = {'R', 'A', 'X', 'R', 'E', 'C', '0', '1'};
+    inline constexpr uint32_t VERSION = 1;
+
+    inline constexpr size_t FILE_HEADER_SIZE  = 16;
+    inline constexpr size_t FRAME_HEADER_SIZE = 12;
+
+    // Largest datagram a recording may hold (UDP payloads are smaller)
+    inline constexpr size_t MAX_FRAME_SIZE = 65536;
+
+    inline constexpr char INDEX_MAGIC[8] = {'R', 'A', 'X', 'I', 'D', 'X', '0', '1'};
+    inline constexpr size_t INDEX_ENTRY_SIZE = 16;
+
+    /**
+     * @brief Path of the index written alongside 'recording'.
+     */
+    [[nodiscard]] inline std::string indexPath(const std::string& recording) {
+        return recording + ".idx";
+    }
+
+    inline void writeLe32(uint8_t* out, uint32_t value) noexcept {
+        for (int i = 0; i < 4; ++i) out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+
+    inline void writeLe64(uint8_t* out, uint64_t value) noexcept {
+        for (int i = 0; i < 8; ++i) out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+
+    [[nodiscard]] inline uint32_t readLe32(const uint8_t* in) noexcept {
+        uint32_t value = 0;
+        for (int i = 3; i >= 0; --i) value = (value << 8) | in[i];
+        return value;
+    }
+
+    [[nodiscard]] inline uint64_t readLe64(const uint8_t* in) noexcept {
+        uint64_t value = 0;
+        for (int i = 7; i >= 0; --i) value = (value << 8) | in[i];
+        return value;
+    }
+
+    [[nodiscard]] inline uint64_t toNanos(const struct timespec& ts) noexcept {
+        return static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ULL + static_cast<uint64_t>(ts.tv_nsec);
+    }
+
+    [[nodiscard]] inline struct timespec fromNanos(uint64_t nanos) noexcept {
+        struct timespec ts{};
+        ts.tv_sec  = static_cast<time_t>(nanos / 1'000'000'000ULL);
+        ts.tv_nsec = static_cast<long>(nanos % 1'000'000'000ULL);
+        return ts;
+    }
+
+} // namespace ReactorAsterix::Recording
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// System headers
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Library headers
+#include <ReactorAsterix/core/AsterixPacketHandler.h>
+
+namespace ReactorAsterix::Recording {
+
+namespace detail {
+    class ReadBackend;
+}
+
+/**
+ * @brief Settings of a Replayer.
+ */
+struct ReplayerConfig {
+    size_t readSize{4 << 20};     // Bytes per read (at least one full frame)
+    bool useIoUring{true};        // Ignored when built without liburing
+};
+
+/**
+ * @brief Copyable replay counters.
+ */
+struct ReplayStats {
+    uint64_t frames{0};
+    uint64_t bytes{0};            // Datagram bytes, frame headers excluded
+    uint64_t truncatedTail{0};    // Bytes of an incomplete last frame (interrupted recording)
+};
+
+/**
+ * @class Replayer
+ * @brief Reads back a recording made by Recorder.
+ *
+ * The file is read in large chunks through two buffers: the next chunk is
+ * read (asynchronously with io_uring, through kernel read-ahead otherwise)
+ * while the frames of the current one are being delivered. Frames are
+ * handed out in place, without copies.
+ *
+ * When the recording has a time index, seek() finds the starting point
+ * with a binary search over the index instead of decoding from the start.
+ * Receive times are assumed to grow along the recording; the index is kept
+ * sorted when they do not.
+ */
+class Replayer {
+    public:
+        using FrameCallback = std::function<void(const uint8_t data[], size_t size, const struct timespec& ts)>;
+
+        explicit Replayer(ReplayerConfig config = {});
+        ~Replayer();
+
+        Replayer(const Replayer&) = delete;
+        Replayer& operator=(const Replayer&) = delete;
+
+        /**
+         * @brief Opens 'path', checks the file header and loads the time
+         * index if there is one.
+         * @return 0 on success, an errno value otherwise (EBADMSG for a bad header).
+         */
+        [[nodiscard]] int open(const std::string& path);
+
+        void close() noexcept;
+
+        /**
+         * @brief Makes the next replay() start with the first frame received
+         * at or after 'from'.
+         *
+         * Without an index the replay still starts at the beginning of the
+         * file and skips the earlier frames.
+         */
+        void seek(const struct timespec& from);
+
+        /**
+         * @brief Makes the next replay() stop before the first frame received
+         * at or after 'until'.
+         */
+        void setEndTime(const struct timespec& until);
+
+        /**
+         * @brief Clears seek() and setEndTime().
+         */
+        void rewind() noexcept;
+
+        [[nodiscard]] bool hasIndex() const noexcept { return !timeIndex.empty(); }
+
+        /**
+         * @brief File offset where the next replay() starts reading.
+         */
+        [[nodiscard]] uint64_t startOffset() const noexcept { return start; }
+
+        /**
+         * @brief Feeds the frames of the selected time range, with their
+         * recorded timestamps, to 'handler'.
+         * @return The number of frames replayed, or -errno.
+         */
+        int64_t replay(AsterixPacketHandler& handler);
+
+        /**
+         * @brief Delivers the frames of the selected time range to 'callback'.
+         * @return The number of frames replayed, or -errno.
+         */
+        int64_t replay(const FrameCallback& callback);
+
+        [[nodiscard]] bool usingIoUring() const noexcept;
+
+        [[nodiscard]] const ReplayStats& getStats() const noexcept { return stats; }
+
+    private:
+        struct IndexEntry {
+            uint64_t nanos;
+            uint64_t offset;
+        };
+
+        void loadIndex(const std::string& path);
+
+        template <typename Sink>
+        int64_t replayFrames(Sink&& sink);
+
+        ReplayerConfig config;
+
+        int fd{-1};
+        std::unique_ptr<uint8_t[]> storage;
+        std::unique_ptr<detail::ReadBackend> backend;
+
+        std::vector<IndexEntry> timeIndex;
+        uint64_t start{0};
+        uint64_t startNanos{0};
+        uint64_t endNanos{UINT64_MAX};
+
+        ReplayStats stats{};
+};
+
+} // namespace ReactorAsterix::Recording
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
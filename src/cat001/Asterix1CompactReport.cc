@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/cat001/Asterix1CompactReport.h>
+
+// System headers
+#include <cmath>
+
+// Library headers
+#include <ReactorAsterix/cat001/Asterix1Report.h>
+
+namespace ReactorAsterix {
+
+namespace {
+    // Same scale factors as the I001/040 and I001/090 decoders,
+    // so that pack() recovers the exact raw values.
+    constexpr double RANGE_SCALE   = 1852.0 / 128.0;
+    constexpr double AZIMUTH_SCALE = 0.00009587379;
+    constexpr double HEIGHT_SCALE  = 25.0 * 0.3048;
+
+    template <typename R>
+    inline R toRaw(double value, double scale) noexcept {
+        return static_cast<R>(std::lround(value / scale));
+    }
+}
+
+Asterix1CompactReport Asterix1CompactReport::pack(const Asterix1Report& report) noexcept {
+    Asterix1CompactReport c{};
+
+    c.tod    = report.TOD;
+    c.todLSP = report.todLSP;
+    c.sac    = report.sourceIdentifier.sac;
+    c.sic    = report.sourceIdentifier.sic;
+
+    c.descriptor = static_cast<uint8_t>(static_cast<uint8_t>(report.ssrpsr) |
+                                        (static_cast<uint8_t>(report.ds1ds2) << 2));
+
+    if (report.spi)         c.flags |= SPI;
+    if (report.hasLspClock) c.flags |= HAS_LSP_CLOCK;
+
+    if (report.hasPolarPosition) {
+        c.flags  |= HAS_POLAR;
+        c.range   = toRaw<uint16_t>(report.range, RANGE_SCALE);
+        c.azimuth = toRaw<uint16_t>(report.azimuth, AZIMUTH_SCALE);
+    }
+
+    if (report.mode3A) {
+        c.flags |= HAS_MODE3A;
+        uint16_t word = report.mode3A->code & MODE3A_CODE_MASK;
+        if (report.mode3A->validated) word |= MODE3A_VALIDATED;
+        if (report.mode3A->garbled)   word |= MODE3A_GARBLED;
+        if (report.mode3A->local)     word |= MODE3A_LOCAL;
+        c.mode3A = word;
+    }
+
+    if (report.ssrHeight) {
+        c.flags |= HAS_MODEC;
+        if (report.ssrHeight->validated) c.flags |= MODEC_VALIDATED;
+        if (report.ssrHeight->garbled)   c.flags |= MODEC_GARBLED;
+        c.modeC = toRaw<int16_t>(report.ssrHeight->height, HEIGHT_SCALE);
+    }
+
+    return c;
+}
+
+void Asterix1CompactReport::unpack(Asterix1Report& report) const noexcept {
+    report.TOD = tod;
+    report.setSourceIdentifier(sac, sic);
+    report.setTruncatedTimeOfDay(todLSP);
+    report.hasLspClock = has(HAS_LSP_CLOCK);
+
+    report.setSSR_PSR(descriptor & 0x03);
+    report.setDs1Ds2((descriptor >> 2) & 0x03);
+    report.setSPI(has(SPI));
+
+    report.hasPolarPosition = has(HAS_POLAR);
+    if (report.hasPolarPosition) {
+        report.range   = static_cast<double>(range) * RANGE_SCALE;
+        report.azimuth = static_cast<double>(azimuth) * AZIMUTH_SCALE;
+    }
+
+    if (has(HAS_MODE3A)) {
+        report.setMode3A(mode3A & MODE3A_CODE_MASK,
+                         mode3A & MODE3A_VALIDATED,
+                         mode3A & MODE3A_GARBLED,
+                         mode3A & MODE3A_LOCAL);
+    }
+
+    if (has(HAS_MODEC)) {
+        report.setSSRHeight(modeC * HEIGHT_SCALE, has(MODEC_VALIDATED), has(MODEC_GARBLED));
+    }
+}
+
+} // namespace ReactorAsterix
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -25,6 +25,7 @@
 // Library headers
 #include <ReactorAsterix/cat001/Asterix1Report.h>
 #include <ReactorAsterix/core/AsterixDiagnostics.h>
+#include <ReactorAsterix/core/AsterixValidation.h>
 #include <ReactorAsterix/core/FastBitReader.h>
 
 namespace ReactorAsterix {
@@ -116,6 +117,27 @@ void I001_020_Handler::decode(Asterix1Report& report, std::string_view data) con
     }
 }
 
+/**
+ * @brief Reports the reserved bits decode() refuses, and a third octet.
+ *
+ * First octet: bits 8-7 and 3-2; second octet: bit 8 and bits 5-4.
+ */
+void I001_020_Handler::validate(std::string_view data, ValidationSink& sink) const {
+    const auto first = static_cast<uint8_t>(data[0]);
+    if (first & 0xC6) {
+        sink.fail(ValidationRule::RESERVED_BITS);
+    }
+    if (data.size() < 2) return;
+
+    const auto second = static_cast<uint8_t>(data[1]);
+    if (second & 0x98) {
+        sink.fail(ValidationRule::RESERVED_BITS, 1);
+    }
+    if (second & 0x01) {
+        sink.fail(ValidationRule::UNEXPECTED_EXTENSION, 1);
+    }
+}
+
 // ----------------------------------------------------------------------------------
 
 /**
@@ -149,6 +171,7 @@ void I001_040_Handler::decode(Asterix1Report& report, std::string_view data) con
     // Which is 2*PI / 65536
     constexpr double AZIMUTH_SCALE = 0.00009587379; // (M_PI / 32768.0)
     report.azimuth = static_cast<double>(rawAzimuth) * AZIMUTH_SCALE;
+    report.hasPolarPosition = true;
 }
 
 // ----------------------------------------------------------------------------------
@@ -184,6 +207,15 @@ void I001_070_Handler::decode(Asterix1Report& report, std::string_view data) con
     report.setMode3A(mode3A, validated, garbled, local);
 }
 
+/**
+ * @brief Reports the spare bit following V, G and L.
+ */
+void I001_070_Handler::validate(std::string_view data, ValidationSink& sink) const {
+    if (static_cast<uint8_t>(data[0]) & 0x10) {
+        sink.fail(ValidationRule::SPARE_BITS);
+    }
+}
+
 /**
  * @brief Handler for ASTERIX Data Item I001/090, Mode-C Code (Flight Level).
  *
@@ -230,6 +262,21 @@ void I001_090_Handler::decode(Asterix1Report& report, std::string_view data) con
     report.setSSRHeight(height, v, g);
 }
 
+/**
+ * @brief Reports a flight level outside -12 to 1270 FL (1/4 FL units).
+ */
+void I001_090_Handler::validate(std::string_view data, ValidationSink& sink) const {
+    uint16_t raw = static_cast<uint16_t>((static_cast<uint8_t>(data[0]) << 8) | static_cast<uint8_t>(data[1]));
+    raw &= 0x3FFF;
+    if (raw & 0x2000) {
+        raw |= 0xC000;
+    }
+    const int16_t flightLevel = static_cast<int16_t>(raw);
+    if (flightLevel < -12 * 4 || flightLevel > 1270 * 4) {
+        sink.fail(ValidationRule::VALUE_OUT_OF_RANGE);
+    }
+}
+
 // ----------------------------------------------------------------------------------
 
 /**
@@ -20,10 +20,11 @@
 
 // System headers
 #include <cmath>
-#include <chrono>
+#include <optional>
 
 // Library headers
 #include <ReactorAsterix/cat001/Asterix1DataItemCollection.h>
+#include <ReactorAsterix/core/TruncatedTime.h>
 
 namespace ReactorAsterix {
 
@@ -37,6 +38,17 @@ Asterix1Handler::Asterix1Handler(std::shared_ptr<SourceStateManager> manager)
     registerHandlers();
 }
 
+/**
+ * @brief Switches report allocation to a per-handler pool.
+ *
+ * Must be called before decoding starts. Reports are then handed to
+ * listeners through onPooledReport() and go back to the pool when the last
+ * handle is released.
+ */
+void Asterix1Handler::enableReportPool(size_t chunkSize) {
+    reportPool = ReportPool<Asterix1Report>::create(chunkSize);
+}
+
 /**
  * @brief Registers the specific handlers for ASTERIX Category 1 data items.
  *
@@ -60,68 +72,19 @@ void Asterix1Handler::registerHandlers() {
     >();
 }
 
-uint32_t Asterix1Handler::calculateCurrentTod() noexcept {
-    using namespace std::chrono;
-
-    // Get time since epoch
-    auto now = system_clock::now().time_since_epoch();
-
-    // Use floor to get the number of whole days (24h periods) since epoch
-    auto days = floor<duration<int, std::ratio<86400>>>(now);
-
-    // Get the duration since the start of the current day
-    auto since_midnight = now - days;
-
-    // ASTERIX TOD: 1 second = 128 units
-    // We convert the duration since midnight to microseconds first for precision,
-    // then scale to ASTERIX units (1/128s).
-    auto micros = duration_cast<microseconds>(since_midnight).count();
-
-    // 128 / 1,000,000 = 1 / 7812.5
-    // Better to multiply by 128 then divide by 1,000,000 to maintain precision
-    return static_cast<uint32_t>((static_cast<uint64_t>(micros) * 128) / 1000000);
-}
-
-uint32_t Asterix1Handler::expandTruncatedTime(uint16_t todLSP, uint32_t refTOD) noexcept {
-    constexpr uint32_t maxTOD   = 86400 * 128;
-    constexpr uint32_t kMspMask = 0xFFFF0000;
-    constexpr uint32_t kWindow  = 0x00010000;
-
-    const uint32_t kTopMsp  = (maxTOD - 1) & kMspMask;
-    const uint32_t HALF_DAY = maxTOD / 2;
-
-    const uint32_t refMSP = refTOD & kMspMask;
-    const uint32_t lsp    = static_cast<uint32_t>(todLSP);
-
-    const uint32_t todA = refMSP | lsp;
-
-    // Calculate candidate B (Crossing lower boundary)
-    const uint32_t todB = (refMSP > 0)       ? (todA - kWindow) : (kTopMsp | lsp);
-
-    // Calculate candidate C (Crossing upper boundary)
-    const uint32_t todC = (refMSP < kTopMsp) ? (todA + kWindow) : lsp;
-
-    auto getDist = [refTOD, maxTOD, HALF_DAY](uint32_t T) -> uint32_t {
-        if (T >= maxTOD) return maxTOD;
-        uint32_t d = (T > refTOD) ? (T - refTOD) : (refTOD - T);
-        return (d > HALF_DAY) ? (maxTOD - d) : d;
-    };
-
-    uint32_t bestT   = todA;
-    uint32_t minDist = getDist(todA);
+/**
+ * @brief Category rule of strict validation mode: a sole primary detection
+ * carries no SSR data (I001/070, I001/090).
+ */
+void Asterix1Handler::validateReport(const Asterix1Report& report, ValidationSink& sink) const {
+    if (report.ssrpsr != Asterix1Report::SSRPSR_T::SOLE_PRIMARY_DETECTION) return;
 
-    // Check Candidate B
-    if (uint32_t dB = getDist(todB); dB < minDist) {
-        minDist = dB;
-        bestT   = todB;
+    if (report.mode3A) {
+        sink.failAt(ValidationRule::CAT001_PRIMARY_WITH_SSR_DATA, I001_070_Handler::FRN, 0);
     }
-
-    // Check Candidate C
-    if (uint32_t dC = getDist(todC); dC < minDist) {
-        bestT   = todC;
+    if (report.ssrHeight) {
+        sink.failAt(ValidationRule::CAT001_PRIMARY_WITH_SSR_DATA, I001_090_Handler::FRN, 0);
     }
-
-    return bestT;
 }
 
 /**
@@ -142,24 +105,45 @@ size_t Asterix1Handler::processDataRecord(
         std::string_view fspec,
         std::string_view payload)
 {
-    // Create the context object (Asterix1Report).
-    Asterix1Report report;
+    // Create the context object (Asterix1Report), from the pool if enabled.
+    // The local one is only constructed when the pool is off.
+    PooledReport<Asterix1Report> pooled;
+    std::optional<Asterix1Report> local;
+    if (reportPool) {
+        pooled = reportPool->acquire();
+    } else {
+        local.emplace();
+    }
+    Asterix1Report& report = pooled ? *pooled : *local;
 
     // Decode everything first.
     // This populates SAC/SIC and the raw 16-bit LSP Clock (if present).
     size_t consumed = this->_processDataRecordInternal(fspec, payload, report);
+    countSource(report, consumed);
 
     if (consumed > 0) {
-        // Get the best available 24-bit reference time
-        uint32_t ref = sourceStateManager->getReferenceTime(
-                report.sourceIdentifier).value_or(calculateCurrentTod());
-
-        report.TOD = report.hasLspClock
-            ? expandTruncatedTime(report.todLSP, ref)
-            : ref;
+        // Get the best available 24-bit reference time.
+        // "Now" is only evaluated for sources without any history.
+        const auto known = sourceStateManager->getReferenceTime(report.sourceIdentifier);
+
+        bool estimated = false;
+        if (report.hasLspClock) {
+            report.TOD = TruncatedTime::expand(report.todLSP, known ? *known : currentTod());
+        } else if (auto estimate = report.hasPolarPosition
+                ? sourceStateManager->estimateTimeAtAzimuth(report.sourceIdentifier, report.azimuth, currentTod())
+                : std::nullopt) {
+            // No I001/141: time the plot from the antenna position
+            report.TOD = *estimate;
+            estimated  = true;
+        } else {
+            report.TOD = known ? *known : currentTod();
+        }
 
-        // Update state with the radar's actual 32-bit time for the next message
-        sourceStateManager->updateSourceTime(report.sourceIdentifier, report.TOD);
+        // Update state with the radar's actual 32-bit time for the next message.
+        // An estimate is not the radar's time and would skew the next one.
+        if (!estimated) {
+            sourceStateManager->updateSourceTime(report.sourceIdentifier, report.TOD);
+        }
 
         {
             // SHARED LOCK: Multiple threads can read/notify safely
@@ -169,7 +153,13 @@ size_t Asterix1Handler::processDataRecord(
             // Notify all valid listeners
             for (const auto& wp : listeners) {
                 if (auto sp = wp.lock()) {
-                    sp->onReportDecoded(report);
+                    notifyListener([&]() {
+                        if (pooled) {
+                            sp->onPooledReport(pooled);
+                        } else {
+                            sp->onReportDecoded(report);
+                        }
+                    });
                 }
             }
         } // Release lock here
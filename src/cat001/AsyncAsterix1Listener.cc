@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/cat001/AsyncAsterix1Listener.h>
+
+// System headers
+#include <chrono>
+
+// Library headers
+#include <ReactorAsterix/cat001/Asterix1Report.h>
+
+namespace ReactorAsterix {
+
+namespace {
+    // Empty polls before the consumer parks on the condition variable
+    constexpr int SPIN_BEFORE_PARK = 256;
+
+    // Upper bound on a missed wake-up
+    constexpr auto PARK_TIMEOUT = std::chrono::milliseconds(1);
+}
+
+AsyncAsterix1Listener::AsyncAsterix1Listener(std::shared_ptr<IAsterix1Listener> _target,
+                                             size_t capacity,
+                                             OverflowPolicy _policy)
+    : target(std::move(_target)), policy(_policy), ring(capacity) {
+    consumer = std::thread(&AsyncAsterix1Listener::run, this);
+}
+
+AsyncAsterix1Listener::~AsyncAsterix1Listener() {
+    running.store(false, std::memory_order_release);
+    wakeConsumer();
+    if (consumer.joinable()) {
+        consumer.join();
+    }
+}
+
+/**
+ * @brief Packs and enqueues one report; never calls the target listener.
+ */
+void AsyncAsterix1Listener::onReportDecoded(const Asterix1Report& report) {
+    const auto compact = Asterix1CompactReport::pack(report);
+
+    if (!ring.tryPush(compact)) [[unlikely]] {
+        switch (policy) {
+            case OverflowPolicy::DROP_NEWEST:
+                droppedNewest.fetch_add(1, std::memory_order_relaxed);
+                return;
+
+            case OverflowPolicy::DROP_OLDEST:
+                // The consumer may have freed a slot in the meantime
+                do {
+                    if (ring.dropOldest()) {
+                        droppedOldest.fetch_add(1, std::memory_order_relaxed);
+                    }
+                } while (!ring.tryPush(compact));
+                break;
+
+            case OverflowPolicy::BLOCK:
+                blocked.fetch_add(1, std::memory_order_relaxed);
+                do {
+                    wakeConsumer();
+                    std::this_thread::yield();
+                } while (!ring.tryPush(compact));
+                break;
+        }
+    }
+
+    enqueued.fetch_add(1, std::memory_order_relaxed);
+
+    if (parked.load(std::memory_order_seq_cst)) {
+        wakeConsumer();
+    }
+}
+
+AsyncAsterix1Listener::Counters AsyncAsterix1Listener::getCounters() const noexcept {
+    return {
+        enqueued.load(std::memory_order_relaxed),
+        delivered.load(std::memory_order_relaxed),
+        droppedOldest.load(std::memory_order_relaxed),
+        droppedNewest.load(std::memory_order_relaxed),
+        blocked.load(std::memory_order_relaxed)
+    };
+}
+
+void AsyncAsterix1Listener::wakeConsumer() {
+    std::lock_guard lock(parkMutex);
+    parkCv.notify_one();
+}
+
+/**
+ * @brief Consumer thread: drains the ring, spins briefly when idle, then
+ * parks until the producer signals new data.
+ */
+void AsyncAsterix1Listener::run() {
+    Asterix1CompactReport compact{};
+    int idle = 0;
+
+    while (true) {
+        if (ring.tryPop(compact)) {
+            Asterix1Report report;
+            compact.unpack(report);
+            target->onReportDecoded(report);
+            delivered.fetch_add(1, std::memory_order_relaxed);
+            idle = 0;
+            continue;
+        }
+
+        if (!running.load(std::memory_order_acquire)) {
+            // Producer is gone and the ring is drained
+            if (ring.empty()) break;
+            continue;
+        }
+
+        if (++idle < SPIN_BEFORE_PARK) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock lock(parkMutex);
+        parked.store(true, std::memory_order_seq_cst);
+        parkCv.wait_for(lock, PARK_TIMEOUT, [this] {
+            return !ring.empty() || !running.load(std::memory_order_acquire);
+        });
+        parked.store(false, std::memory_order_relaxed);
+        idle = 0;
+    }
+}
+
+} // namespace ReactorAsterix
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
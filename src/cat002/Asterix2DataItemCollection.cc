@@ -25,6 +25,7 @@
 
 // Library headers
 #include <ReactorAsterix/cat002/Asterix2Report.h>
+#include <ReactorAsterix/core/AsterixValidation.h>
 
 namespace ReactorAsterix {
 
@@ -49,6 +50,44 @@ void I002_010_Handler::decode(Asterix2Report& report, std::string_view data) con
 
 // ----------------------------------------------------------------------------------
 
+/**
+ * @brief Decodes the 1-byte Message Type (North marker, Sector crossing, ...).
+ *
+ * @param context The target context object (Asterix2Report) to store the result.
+ * @param data The raw data buffer containing the message type.
+ */
+void I002_000_Handler::decode(Asterix2Report& context, std::string_view data) const {
+    context.setMessageType(static_cast<uint8_t>(data[0]));
+}
+
+/**
+ * @brief Reports a message type that Asterix2Report::MessageType does not define.
+ */
+void I002_000_Handler::validate(std::string_view data, ValidationSink& sink) const {
+    switch (static_cast<Asterix2Report::MessageType>(data[0])) {
+        case Asterix2Report::MessageType::NORTH_MARKER:
+        case Asterix2Report::MessageType::SECTOR_CROSSING:
+        case Asterix2Report::MessageType::SOUTH_MARKER:
+        case Asterix2Report::MessageType::ACTIVATION_OF_BLIND_ZONE_FILTERING:
+        case Asterix2Report::MessageType::STOP_OF_BLIND_ZONE_FILTERING:
+            return;
+        default:
+            sink.fail(ValidationRule::VALUE_OUT_OF_RANGE);
+    }
+}
+
+/**
+ * @brief Decodes the 1-byte Sector Number.
+ *
+ * The value is the azimuth of the sector boundary, LSB = 360/2^8 degrees.
+ *
+ * @param context The target context object (Asterix2Report) to store the result.
+ * @param data The raw data buffer containing the sector number.
+ */
+void I002_020_Handler::decode(Asterix2Report& context, std::string_view data) const {
+    context.setSectorNumber(static_cast<uint8_t>(data[0]));
+}
+
 /**
  * @brief Decodes the 3-byte Time of Day (TOD).
  * The TOD value is constructed from the three bytes, where the unit is in
@@ -65,6 +104,19 @@ void I002_030_Handler::decode(Asterix2Report& context, std::string_view data) co
     context.TOD = tod;
 }
 
+/**
+ * @brief Reports a time of day of 24 h or more (1/128 s units).
+ */
+void I002_030_Handler::validate(std::string_view data, ValidationSink& sink) const {
+    constexpr uint32_t TOD_PER_DAY = 86400 * 128;
+    const uint32_t tod = (static_cast<uint32_t>(static_cast<uint8_t>(data[0])) << 16) |
+                         (static_cast<uint32_t>(static_cast<uint8_t>(data[1])) << 8)  |
+                         (static_cast<uint32_t>(static_cast<uint8_t>(data[2])));
+    if (tod >= TOD_PER_DAY) {
+        sink.fail(ValidationRule::VALUE_OUT_OF_RANGE);
+    }
+}
+
 /**
  * @brief Decodes the 2-byte Antenna Rotation Speed.
  *
@@ -82,6 +134,9 @@ void I002_041_Handler::decode(Asterix2Report& context, std::string_view data) co
 
     // The value is in units of 1/128 RPM.
     context.setAntennaSpeed(speedTemp / 128.0f);
+
+    // Keep the raw value for the per-source scan tracking
+    context.setAntennaPeriod(speedTemp);
 }
 
 } // namespace ReactorAsterix
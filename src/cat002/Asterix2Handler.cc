@@ -53,6 +53,16 @@ void Asterix2Handler::registerHandlers() {
     >();
 }
 
+/**
+ * @brief Category rule of strict validation mode: a sector crossing message
+ * tells which sector (I002/020).
+ */
+void Asterix2Handler::validateReport(const Asterix2Report& report, ValidationSink& sink) const {
+    if (report.messageType == Asterix2Report::MessageType::SECTOR_CROSSING && !report.hasSectorNumber) {
+        sink.failAt(ValidationRule::CAT002_SECTOR_WITHOUT_NUMBER, I002_020_Handler::FRN, 0);
+    }
+}
+
 /**
  * @brief Handles the processing of a single ASTERIX Category 2 data record.
  *
@@ -75,11 +85,31 @@ size_t Asterix2Handler::processDataRecord(
 
     // Decode everything first.
     size_t consumed = this->_processDataRecordInternal(fspec, payload, report);
+    countSource(report, consumed);
 
     if (consumed > 0) {
         // Update state with the radar's actual 32-bit time for the next message
         sourceStateManager->updateSourceTime(report.sourceIdentifier, report.TOD);
 
+        // Track the antenna rotation so plots can be timed by azimuth
+        if (report.hasAntennaPeriod) {
+            sourceStateManager->updateAntennaPeriod(report.sourceIdentifier, report.antennaPeriod);
+        }
+
+        switch (report.messageType) {
+            case Asterix2Report::MessageType::NORTH_MARKER:
+                sourceStateManager->updateNorthMarker(report.sourceIdentifier, report.TOD);
+                break;
+            case Asterix2Report::MessageType::SECTOR_CROSSING:
+                if (report.hasSectorNumber) {
+                    sourceStateManager->updateSectorCrossing(
+                            report.sourceIdentifier, report.TOD, report.sectorNumber);
+                }
+                break;
+            default:
+                break;
+        }
+
         {
             // SHARED LOCK: Multiple threads can read/notify safely
             // But blocks if someone is currently adding a listener
@@ -88,7 +118,7 @@ size_t Asterix2Handler::processDataRecord(
             // Notify all valid listeners
             for (const auto& wp : listeners) {
                 if (auto sp = wp.lock()) {
-                    sp->onReportDecoded(report);
+                    notifyListener([&]() { sp->onReportDecoded(report); });
                 }
             }
         } // Release lock here
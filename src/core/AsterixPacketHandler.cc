@@ -22,9 +22,12 @@
 #include <algorithm>
 #include <arpa/inet.h>
 #include <cstring>
+#include <ctime>
 
 // Library headers
 #include <ReactorAsterix/core/AsterixConstants.h>
+#include <ReactorAsterix/core/AsterixProbes.h>
+#include <ReactorAsterix/core/Fspec.h>
 
 namespace ReactorAsterix {
 
@@ -49,8 +52,12 @@ void AsterixPacketHandler::registerCategoryHandler(
         std::unique_ptr<IAsterixCategoryHandler> handler) {
     if (!handler) return;
 
-    // Link the statistics object
+    // Link the statistics object and the time reference
     handler->setStats(this->stats);
+    handler->setTimeReference(this->timeReference);
+    handler->setLatencyStats(this->latency.load(std::memory_order_relaxed));
+    handler->setBreakdownStats(&this->categoryStats[category], this->sourceStats.load(std::memory_order_relaxed));
+    handler->setValidationLog(this->validation.load(std::memory_order_relaxed), category);
 
     // CHECK FOR EXISTING HANDLER (The "Reset" Logic)
     // If the lookup table already has a pointer for this category,
@@ -70,6 +77,59 @@ void AsterixPacketHandler::registerCategoryHandler(
     categoryPool.push_back(std::move(handler));
 }
 
+/**
+ * @brief Links (or unlinks) the histograms to the registered category
+ * handlers, allocating them on first use.
+ */
+void AsterixPacketHandler::enableLatencyHistograms(bool enable) {
+    if (enable && !latencyStorage) latencyStorage = std::make_unique<AsterixLatencyStats>();
+
+    AsterixLatencyStats* histograms = enable ? latencyStorage.get() : nullptr;
+    for (auto& handler : categoryPool) handler->setLatencyStats(histograms);
+    latency.store(histograms, std::memory_order_release);
+}
+
+/**
+ * @brief Links (or unlinks) the per-source table to the registered
+ * category handlers, allocating it on first use.
+ */
+void AsterixPacketHandler::enableSourceStats(bool enable) {
+    if (enable && !sourceStorage) sourceStorage = std::make_unique<AsterixSourceStats>();
+
+    AsterixSourceStats* table = enable ? sourceStorage.get() : nullptr;
+    for (size_t category = 0; category < categoryHandlers.size(); ++category) {
+        if (auto* handler = categoryHandlers[category]) {
+            handler->setBreakdownStats(&categoryStats[category], table);
+        }
+    }
+    sourceStats.store(table, std::memory_order_release);
+}
+
+/**
+ * @brief Links (or unlinks) the validation log to the registered category
+ * handlers, allocating it on first use.
+ */
+void AsterixPacketHandler::enableValidation(bool enable, size_t capacity) {
+    if (enable && !validationStorage) validationStorage = std::make_unique<AsterixValidationLog>(capacity);
+
+    AsterixValidationLog* log = enable ? validationStorage.get() : nullptr;
+    for (size_t category = 0; category < categoryHandlers.size(); ++category) {
+        if (auto* handler = categoryHandlers[category]) {
+            handler->setValidationLog(log, static_cast<uint8_t>(category));
+        }
+    }
+    validation.store(log, std::memory_order_release);
+}
+
+std::vector<AsterixCategoryStatsData> AsterixPacketHandler::getCategoryBreakdown() const {
+    std::vector<AsterixCategoryStatsData> out;
+    for (size_t category = 0; category < categoryStats.size(); ++category) {
+        const auto data = categoryStats[category].snapshot(static_cast<uint8_t>(category));
+        if (data.blocks > 0 || data.malformedBlocks > 0) out.push_back(data);
+    }
+    return out;
+}
+
 /**
  * @brief Top-level loop to process a stream of data.
  * ASTERIX packets over UDP often contain multiple concatenated Data Blocks.
@@ -82,13 +142,28 @@ void AsterixPacketHandler::registerCategoryHandler(
  * @param data A pointer to the raw ASTERIX frame data.
  * @param size The total length of the ASTERIX frame data in bytes.
  */
-void AsterixPacketHandler::handlePacket(const uint8_t data[], size_t size, struct timespec) {
+void AsterixPacketHandler::handlePacket(const uint8_t data[], size_t size, struct timespec ts) {
     // Fast exit for empty packets
     if (!data || size == 0) [[unlikely]] return;
 
+    REACTORASTERIX_PROBE4(packet__entry, data, size, ts.tv_sec, ts.tv_nsec);
+
+    // Cheap: only stores the timestamp, the TOD is computed on demand
+    timeReference.beginPacket(ts);
+
     // Increment total packets received
     stats.totalPackets.fetch_add(1, std::memory_order_relaxed);
 
+    // Time spent between the kernel timestamp and now
+    AsterixLatencyStats* histograms = latency.load(std::memory_order_relaxed);
+    if (histograms && (ts.tv_sec != 0 || ts.tv_nsec != 0)) [[unlikely]] {
+        struct timespec now{};
+        clock_gettime(CLOCK_REALTIME, &now);
+        const int64_t delay = static_cast<int64_t>(now.tv_sec - ts.tv_sec) * 1'000'000'000LL
+                              + (now.tv_nsec - ts.tv_nsec);
+        if (delay >= 0) histograms->receive.record(static_cast<uint64_t>(delay));
+    }
+
     // Create a view to manage the buffer without manual pointer arithmetic errors
     std::string_view buffer(reinterpret_cast<const char*>(data), size);
 
@@ -111,6 +186,15 @@ void AsterixPacketHandler::handlePacket(const uint8_t data[], size_t size, struc
     }
 }
 
+/**
+ * @brief Batch entry point used by the network receivers.
+ */
+void AsterixPacketHandler::handlePackets(const AsterixDatagram datagrams[], size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        handlePacket(datagrams[i].data, datagrams[i].size, datagrams[i].ts);
+    }
+}
+
 /**
  * @brief Decodes the ASTERIX Block Header (CAT + LEN) and dispatches to a handler.
  *
@@ -134,17 +218,34 @@ size_t AsterixPacketHandler::processDataBlock(std::string_view block) {
     // Read Length (Octets 2-3) using helper
     const uint16_t length = readBe16(block, 1);
 
+    AsterixCategoryStats& counters = categoryStats[category];
+
     // Sanity Checks:
     // Length must be at least the size of the header.
     // Length must not exceed the actual data available in the buffer.
     if (length < Constants::HEADER_SIZE || length > block.size()) [[unlikely]] {
+        REACTORASTERIX_PROBE3(block__malformed, category, length, block.size());
+        addSingleWriter(counters.malformedBlocks);
         return 0;
     }
 
+    addSingleWriter(counters.blocks);
+    addSingleWriter(counters.bytes, length);
+
     auto* handler = categoryHandlers[category];
+    REACTORASTERIX_PROBE3(block__dispatch, category, length, handler != nullptr);
 
     if (handler) [[likely]] {
         size_t offset = Constants::HEADER_SIZE;
+        uint64_t records = 0;
+
+        // Only this thread turns the histograms on or off
+        AsterixLatencyStats* histograms = latency.load(std::memory_order_relaxed);
+        uint64_t blockStart = 0;
+        if (histograms) [[unlikely]] {
+            histograms->listenerNanosInBlock = 0;
+            blockStart = LatencyHistogram::monotonicNanos();
+        }
 
         // A single Data Block can contain multiple Data Records.
         while (offset < length) {
@@ -155,18 +256,37 @@ size_t AsterixPacketHandler::processDataBlock(std::string_view block) {
 
             if (consumed > 0) {
                 offset += consumed;
+                ++records;
             } else [[unlikely]] {
                 // If a record cannot be parsed, skip the rest of this block.
                 // Track specific record failures.
                 stats.recordParseErrors.fetch_add(1, std::memory_order_relaxed);
+                addSingleWriter(counters.recordParseErrors);
+
+                // Records whose FSPEC never ends do not reach the handler
+                AsterixValidationLog* log = validation.load(std::memory_order_relaxed);
+                if (log && Fspec::length(reinterpret_cast<const uint8_t*>(remaining.data()),
+                                         remaining.size()) == 0) [[unlikely]] {
+                    const uint64_t record = log->beginRecord();
+                    log->report({record, 0, ValidationRule::FSPEC_NOT_CLOSED, category, 0});
+                }
 
                 // Abort the rest of the block; we cannot trust the stream position.
                 break;
             }
         }
+
+        addSingleWriter(counters.records, records);
+
+        // Decode time only: listener callbacks are timed separately
+        if (histograms) [[unlikely]] {
+            const uint64_t elapsed = LatencyHistogram::monotonicNanos() - blockStart;
+            histograms->decode.record(elapsed - std::min(elapsed, histograms->listenerNanosInBlock));
+        }
     } else [[unlikely]] {
         // Increment stats if the category is not registered
         stats.unhandledCategories.fetch_add(1, std::memory_order_relaxed);
+        addSingleWriter(counters.unhandledBlocks);
     }
 
     // Return the total length of the data block so handlePacket can advance
@@ -189,49 +309,11 @@ size_t AsterixPacketHandler::processDataBlock(std::string_view block) {
 size_t AsterixPacketHandler::dispatchRecord(std::string_view recordView, IAsterixCategoryHandler* handler) {
     const auto* const data = reinterpret_cast<const uint8_t*>(recordView.data());
 
-    // Calculate F-Spec size
-    // The F-Spec is at least 1 byte.
-    // If the FX bit (LSB) is set, it extends to the next byte.
-    size_t fspecSize = 0;
-    size_t lastDataIdx = 0;
-    uint8_t lastDataValue = 0;
-
-    // Calculate F-Spec size safely
-    while (true) {
-        // Ensure we don't read past the buffer
-        if (fspecSize >= recordView.size() || fspecSize >= Constants::MAX_FSPEC_SIZE) [[unlikely]] {
-            return 0;
-        }
-
-        const uint8_t currentByte = data[fspecSize];
-
-        // If there are bits other than the FX bit (bit 0), save it
-        if (currentByte > 1) {
-            lastDataIdx = fspecSize;
-            lastDataValue = currentByte;
-        }
-
-        fspecSize++;
-
-        // Check FX bit
-        if (!(currentByte & Constants::FX_BIT)) break;
-    }
-
-    // --- CONSOLIDATED BOUNDS CHECK ---
-    // Validate if the furthest data bit exceeds MAX_FRNS (128)
-    if (lastDataValue > 0) {
-        // 128 FRNs = 18 full bytes (126 bits) + 2 bits in the 19th byte
-        if (lastDataIdx > 18) [[unlikely]] {
-            return 0;
-        }
-        // If at index 18 (19th byte), only bits 7 and 6 (FRNs 127, 128) are allowed
-        if (lastDataIdx == 18 && (lastDataValue & 0x3E)) [[unlikely]] {
-            return 0;
-        }
-    }
-
-    // Ensure we have at least 1 byte of payload (usually) or that the view is valid
-    if (fspecSize > recordView.size()) [[unlikely]] return 0;
+    // Calculate F-Spec size from the FX bits. MAX_FSPEC_SIZE bytes announce
+    // at most 70 FRNs, so no FRN can exceed MAX_FRNS (128).
+    static_assert(Constants::MAX_FSPEC_SIZE * 7 <= 128);
+    const size_t fspecSize = Fspec::length(data, recordView.size());
+    if (fspecSize == 0) [[unlikely]] return 0;
 
     auto fspec   = recordView.substr(0, fspecSize);
     auto payload = recordView.substr(fspecSize);
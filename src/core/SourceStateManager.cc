@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/core/SourceStateManager.h>
+
+// System headers
+#include <cmath>
+
+namespace ReactorAsterix {
+
+namespace {
+    constexpr uint32_t MAX_TOD = 86400 * 128;
+
+    // Forward distance from 'from' to 'to' on the 24h circle
+    inline uint32_t todForward(uint32_t from, uint32_t to) noexcept {
+        return (to >= from) ? (to - from) : (MAX_TOD - from + to);
+    }
+
+    inline uint32_t todAdd(uint32_t tod, uint32_t delta) noexcept {
+        return (tod + delta) % MAX_TOD;
+    }
+}
+
+/**
+ * @brief Records a north crossing and derives the scan period from it.
+ *
+ * When markers are lost, the elapsed time spans several revolutions: the
+ * scan number is advanced accordingly and the period is left untouched.
+ * A duplicate or early marker (less than half a revolution after the last
+ * one) is ignored.
+ */
+void SourceStateManager::updateNorthMarker(const SourceIdentifier& si, uint32_t tod) {
+    ScanState& scan = sources[si].scan;
+
+    if (scan.flags & ScanState::HAS_NORTH) {
+        const uint32_t elapsed = todForward(scan.lastNorthTod, tod);
+        if (elapsed == 0 || elapsed < scan.scanPeriod / 2) return;
+
+        uint32_t turns = 1;
+        if (scan.scanPeriod > 0) {
+            // Round to the nearest number of revolutions, at least one here
+            turns = (elapsed + scan.scanPeriod / 2) / scan.scanPeriod;
+        }
+
+        if (turns == 1 && !(scan.flags & ScanState::PERIOD_FROM_041)) {
+            scan.scanPeriod = elapsed;
+        }
+        scan.scanNumber += turns;
+    } else {
+        scan.scanNumber = 1;
+    }
+
+    scan.lastNorthTod = tod;
+    scan.flags |= ScanState::HAS_NORTH;
+}
+
+void SourceStateManager::updateSectorCrossing(const SourceIdentifier& si, uint32_t tod, uint8_t sector) {
+    ScanState& scan = sources[si].scan;
+
+    scan.lastSectorTod = tod;
+    scan.lastSector    = sector;
+    scan.flags |= ScanState::HAS_SECTOR;
+}
+
+void SourceStateManager::updateAntennaPeriod(const SourceIdentifier& si, uint16_t rawPeriod) {
+    if (rawPeriod == 0) return;
+
+    ScanState& scan = sources[si].scan;
+
+    scan.scanPeriod = rawPeriod;
+    scan.flags |= ScanState::PERIOD_FROM_041;
+}
+
+/**
+ * @brief Interpolates the TOD at which the antenna pointed at 'azimuth'.
+ *
+ * The anchor is the last north crossing, or the last sector crossing when
+ * it belongs to the current revolution and lies before the plot azimuth.
+ * Plots reported just after the north marker but measured before it would
+ * land more than half a revolution after their arrival: those are moved
+ * back by one revolution.
+ */
+std::optional<uint32_t> SourceStateManager::estimateTimeAtAzimuth(
+        const SourceIdentifier& si, double azimuth, uint32_t arrivalTod) const {
+    const auto it = sources.find(si);
+    if (it == sources.end()) return std::nullopt;
+
+    const ScanState& scan = it->second.scan;
+    if (!(scan.flags & ScanState::HAS_NORTH) || scan.scanPeriod == 0) return std::nullopt;
+
+    // Fraction of a revolution, in [0, 1)
+    constexpr double TWO_PI = 2.0 * M_PI;
+    double turn = std::fmod(azimuth, TWO_PI) / TWO_PI;
+    if (turn < 0.0) turn += 1.0;
+
+    uint32_t anchorTod = scan.lastNorthTod;
+    double anchorTurn  = 0.0;
+
+    if (scan.flags & ScanState::HAS_SECTOR) {
+        const double sectorTurn = static_cast<double>(scan.lastSector) / 256.0;
+        if (todForward(scan.lastNorthTod, scan.lastSectorTod) < scan.scanPeriod && sectorTurn <= turn) {
+            anchorTod  = scan.lastSectorTod;
+            anchorTurn = sectorTurn;
+        }
+    }
+
+    const auto offset = static_cast<uint32_t>((turn - anchorTurn) * scan.scanPeriod);
+    uint32_t estimate = todAdd(anchorTod, offset);
+
+    const uint32_t ahead = todForward(arrivalTod, estimate);
+    if (ahead < MAX_TOD / 2 && ahead > scan.scanPeriod / 2) {
+        estimate = todAdd(estimate, MAX_TOD - scan.scanPeriod);
+    }
+
+    return estimate;
+}
+
+} // namespace ReactorAsterix
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/core/TimeReference.h>
+
+namespace ReactorAsterix {
+
+namespace {
+    // CLOCK_REALTIME_COARSE is served from the vDSO without touching the
+    // hardware counter. Its resolution is one jiffy, 1 to 10 ms with the
+    // usual HZ settings: comparable to a 1/128 s TOD tick (7.8 ms), so the
+    // result may lag by about one tick.
+    inline struct timespec readCoarseClock() noexcept {
+        struct timespec ts{};
+#ifdef CLOCK_REALTIME_COARSE
+        clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+#else
+        clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+        return ts;
+    }
+}
+
+uint32_t TimeReference::systemTod() noexcept {
+    return todFromTimespec(readCoarseClock());
+}
+
+/**
+ * @brief Recomputes the cached TOD from the configured source.
+ */
+void TimeReference::refresh() noexcept {
+    const struct timespec now =
+        (source == Source::PacketTimestamp && hasTimestamp(packetTs))
+            ? packetTs
+            : readCoarseClock();
+
+    cachedTod = todFromTimespec(now);
+    stampNs   = hasTimestamp(packetTs) ? toNanos(packetTs) : 0;
+    valid     = true;
+}
+
+} // namespace ReactorAsterix
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/core/TruncatedTime.h>
+
+namespace ReactorAsterix::TruncatedTime {
+
+namespace {
+    constexpr uint32_t maxTOD   = 86400 * 128;
+    constexpr uint32_t kMspMask = 0xFFFF0000;
+    constexpr uint32_t kWindow  = 0x00010000;
+    constexpr uint32_t kTopMsp  = (maxTOD - 1) & kMspMask;
+    constexpr uint32_t HALF_DAY = maxTOD / 2;
+}
+
+uint32_t expand(uint16_t todLSP, uint32_t refTOD) noexcept {
+    const uint32_t refMSP = refTOD & kMspMask;
+    const uint32_t lsp    = static_cast<uint32_t>(todLSP);
+
+    const uint32_t todA = refMSP | lsp;
+
+    // Calculate candidate B (Crossing lower boundary)
+    const uint32_t todB = (refMSP > 0)       ? (todA - kWindow) : (kTopMsp | lsp);
+
+    // Calculate candidate C (Crossing upper boundary)
+    const uint32_t todC = (refMSP < kTopMsp) ? (todA + kWindow) : lsp;
+
+    auto getDist = [refTOD](uint32_t T) -> uint32_t {
+        if (T >= maxTOD) return maxTOD;
+        uint32_t d = (T > refTOD) ? (T - refTOD) : (refTOD - T);
+        return (d > HALF_DAY) ? (maxTOD - d) : d;
+    };
+
+    uint32_t bestT   = todA;
+    uint32_t minDist = getDist(todA);
+
+    // Check Candidate B
+    if (uint32_t dB = getDist(todB); dB < minDist) {
+        minDist = dB;
+        bestT   = todB;
+    }
+
+    // Check Candidate C
+    if (uint32_t dC = getDist(todC); dC < minDist) {
+        bestT   = todC;
+    }
+
+    return bestT;
+}
+
+} // namespace ReactorAsterix::TruncatedTime
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/export/ColumnarExporters.h>
+
+// System headers
+#include <cstddef>
+#include <utility>
+
+// Library headers
+#include <ReactorAsterix/cat001/Asterix1CompactReport.h>
+#include <ReactorAsterix/cat001/Asterix1Report.h>
+#include <ReactorAsterix/cat002/Asterix2Report.h>
+
+namespace ReactorAsterix::Export {
+
+namespace {
+    std::vector<ColumnDef> asterix1Columns() {
+        using R = Asterix1CompactReport;
+        return {
+            {"tod",        ColumnType::U32, offsetof(R, tod)},
+            {"sac",        ColumnType::U8,  offsetof(R, sac)},
+            {"sic",        ColumnType::U8,  offsetof(R, sic)},
+            {"range",      ColumnType::U16, offsetof(R, range)},
+            {"azimuth",    ColumnType::U16, offsetof(R, azimuth)},
+            {"mode3A",     ColumnType::U16, offsetof(R, mode3A)},
+            {"modeC",      ColumnType::I16, offsetof(R, modeC)},
+            {"todLSP",     ColumnType::U16, offsetof(R, todLSP)},
+            {"descriptor", ColumnType::U8,  offsetof(R, descriptor)},
+            {"flags",      ColumnType::U8,  offsetof(R, flags)}
+        };
+    }
+
+    std::vector<ColumnDef> asterix2Columns() {
+        using R = Asterix2ColumnRow;
+        return {
+            {"tod",           ColumnType::U32, offsetof(R, tod)},
+            {"sac",           ColumnType::U8,  offsetof(R, sac)},
+            {"sic",           ColumnType::U8,  offsetof(R, sic)},
+            {"messageType",   ColumnType::U8,  offsetof(R, messageType)},
+            {"sectorNumber",  ColumnType::U8,  offsetof(R, sectorNumber)},
+            {"antennaPeriod", ColumnType::U16, offsetof(R, antennaPeriod)},
+            {"antennaSpeed",  ColumnType::F32, offsetof(R, antennaSpeed)},
+            {"flags",         ColumnType::U8,  offsetof(R, flags)}
+        };
+    }
+}
+
+Asterix1ColumnarExporter::Asterix1ColumnarExporter(ColumnarWriterConfig config)
+    : writer(SCHEMA, sizeof(Asterix1CompactReport), asterix1Columns(), std::move(config)) {
+}
+
+void Asterix1ColumnarExporter::onReportDecoded(const Asterix1Report& report) {
+    const Asterix1CompactReport row = Asterix1CompactReport::pack(report);
+    writer.append(&row);
+}
+
+Asterix2ColumnarExporter::Asterix2ColumnarExporter(ColumnarWriterConfig config)
+    : writer(SCHEMA, sizeof(Asterix2ColumnRow), asterix2Columns(), std::move(config)) {
+}
+
+void Asterix2ColumnarExporter::onReportDecoded(const Asterix2Report& report) {
+    Asterix2ColumnRow row{};
+    row.tod           = report.TOD;
+    row.antennaSpeed  = report.antennaSpeed;
+    row.antennaPeriod = report.antennaPeriod;
+    row.sac           = report.sourceIdentifier.sac;
+    row.sic           = report.sourceIdentifier.sic;
+    row.messageType   = static_cast<uint8_t>(report.messageType);
+    row.sectorNumber  = report.sectorNumber;
+    row.flags         = static_cast<uint8_t>((report.hasSectorNumber ? Asterix2ColumnRow::HAS_SECTOR : 0) |
+                                             (report.hasAntennaPeriod ? Asterix2ColumnRow::HAS_PERIOD : 0));
+    writer.append(&row);
+}
+
+} // namespace ReactorAsterix::Export
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/export/ColumnarReader.h>
+
+// System headers
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ReactorAsterix::Export {
+
+namespace {
+    /**
+     * @return 0 if all 'size' bytes were read, an errno value otherwise.
+     */
+    int preadExact(int fd, void* data, size_t size, uint64_t offset) {
+        auto* p = static_cast<uint8_t*>(data);
+        while (size > 0) {
+            const ssize_t n = ::pread(fd, p, size, static_cast<off_t>(offset));
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return errno;
+            }
+            if (n == 0) return EBADMSG;
+            p      += n;
+            size   -= static_cast<size_t>(n);
+            offset += static_cast<uint64_t>(n);
+        }
+        return 0;
+    }
+
+    template <typename T>
+    T get(const uint8_t* p) noexcept {
+        T value;
+        std::memcpy(&value, p, sizeof(T));
+        return value;
+    }
+}
+
+ColumnarReader::~ColumnarReader() {
+    close();
+}
+
+int ColumnarReader::open(const std::string& path) {
+    close();
+
+    fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return errno;
+
+    auto fail = [this](int err) {
+        close();
+        return err;
+    };
+
+    struct stat st{};
+    if (fstat(fd, &st) < 0) return fail(errno);
+    const auto fileSize = static_cast<uint64_t>(st.st_size);
+
+    // Header: magic, version, schema, column count and descriptors
+    uint8_t header[20];
+    if (fileSize < sizeof(header) + FOOTER_TAIL_SIZE) return fail(EBADMSG);
+    if (int err = preadExact(fd, header, sizeof(header), 0)) return fail(err);
+    if (std::memcmp(header, COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC)) != 0 ||
+        get<uint32_t>(header + 8) != COLUMNAR_VERSION) {
+        return fail(EBADMSG);
+    }
+    schemaId = get<uint32_t>(header + 12);
+
+    uint64_t offset = sizeof(header);
+    const uint32_t count = get<uint32_t>(header + 16);
+    for (uint32_t i = 0; i < count; ++i) {
+        uint8_t desc[2];
+        if (int err = preadExact(fd, desc, sizeof(desc), offset)) return fail(err);
+
+        Column column{std::string(desc[1], '\0'), static_cast<ColumnType>(desc[0])};
+        if (int err = preadExact(fd, column.name.data(), desc[1], offset + 2)) return fail(err);
+        if (columnTypeSize(column.type) == 0) return fail(EBADMSG);
+
+        columnList.push_back(std::move(column));
+        offset += 2 + desc[1];
+    }
+
+    // Footer: row group directory, located by the trailing offset and magic
+    uint8_t tail[FOOTER_TAIL_SIZE];
+    if (int err = preadExact(fd, tail, sizeof(tail), fileSize - sizeof(tail))) return fail(err);
+    if (std::memcmp(tail + 8, FOOTER_MAGIC, sizeof(FOOTER_MAGIC)) != 0) return fail(EBADMSG);
+
+    const uint64_t footerOffset = get<uint64_t>(tail);
+    if (footerOffset < offset || footerOffset > fileSize - sizeof(tail)) return fail(EBADMSG);
+
+    std::vector<uint8_t> footer(static_cast<size_t>(fileSize - sizeof(tail) - footerOffset));
+    if (int err = preadExact(fd, footer.data(), footer.size(), footerOffset)) return fail(err);
+
+    for (size_t at = 0; at + FOOTER_ENTRY_SIZE <= footer.size(); at += FOOTER_ENTRY_SIZE) {
+        groups.push_back({get<uint64_t>(footer.data() + at), get<uint32_t>(footer.data() + at + 8), false, {}});
+    }
+    return 0;
+}
+
+void ColumnarReader::close() noexcept {
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+    schemaId = 0;
+    columnList.clear();
+    groups.clear();
+}
+
+int ColumnarReader::findColumn(const std::string& name) const noexcept {
+    for (size_t i = 0; i < columnList.size(); ++i) {
+        if (columnList[i].name == name) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+int ColumnarReader::loadGroup(GroupInfo& group) {
+    if (group.loaded) return 0;
+
+    const size_t size = ROW_GROUP_HEADER_SIZE + columnList.size() * COLUMN_CHUNK_HEADER_SIZE;
+    std::vector<uint8_t> header(size);
+    if (int err = preadExact(fd, header.data(), size, group.offset)) return err;
+    if (get<uint32_t>(header.data()) != group.rows) return EBADMSG;
+
+    uint64_t dataOffset = group.offset + size;
+    group.chunks.clear();
+    for (size_t c = 0; c < columnList.size(); ++c) {
+        const uint8_t* chunk = header.data() + ROW_GROUP_HEADER_SIZE + c * COLUMN_CHUNK_HEADER_SIZE;
+        const auto bytes = get<uint64_t>(chunk + 16);
+        if (bytes != uint64_t{group.rows} * columnTypeSize(columnList[c].type)) return EBADMSG;
+        group.chunks.push_back({{get<double>(chunk), get<double>(chunk + 8)}, dataOffset, bytes});
+        dataOffset += padTo8(static_cast<size_t>(bytes));
+    }
+
+    group.loaded = true;
+    return 0;
+}
+
+int ColumnarReader::stats(size_t group, size_t column, ColumnStats& out) {
+    if (group >= groups.size() || column >= columnList.size()) return EINVAL;
+    if (int err = loadGroup(groups[group])) return err;
+
+    out = groups[group].chunks[column].stats;
+    return 0;
+}
+
+int ColumnarReader::readColumn(size_t group, size_t column, std::vector<uint8_t>& out) {
+    if (group >= groups.size() || column >= columnList.size()) return EINVAL;
+    if (int err = loadGroup(groups[group])) return err;
+
+    const ChunkInfo& chunk = groups[group].chunks[column];
+    out.resize(static_cast<size_t>(chunk.bytes));
+    return preadExact(fd, out.data(), out.size(), chunk.offset);
+}
+
+} // namespace ReactorAsterix::Export
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/export/ColumnarWriter.h>
+
+// System headers
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <unistd.h>
+#include <utility>
+
+// Library headers
+#include <ReactorAsterix/export/ColumnarFormat.h>
+
+namespace ReactorAsterix::Export {
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "Column arrays are written in host order");
+
+namespace {
+    template <typename T>
+    void put(std::vector<uint8_t>& out, T value) {
+        const size_t at = out.size();
+        out.resize(at + sizeof(T));
+        std::memcpy(out.data() + at, &value, sizeof(T));
+    }
+
+    /**
+     * @brief Gathers one field of every row into a contiguous array.
+     */
+    template <typename T>
+    void transpose(const uint8_t* rows, size_t count, size_t rowSize, size_t offset,
+                   uint8_t* out, double& min, double& max) {
+        T lo = std::numeric_limits<T>::max();
+        T hi = std::numeric_limits<T>::lowest();
+        for (size_t i = 0; i < count; ++i) {
+            T value;
+            std::memcpy(&value, rows + i * rowSize + offset, sizeof(T));
+            std::memcpy(out + i * sizeof(T), &value, sizeof(T));
+            lo = std::min(lo, value);
+            hi = std::max(hi, value);
+        }
+        min = static_cast<double>(lo);
+        max = static_cast<double>(hi);
+    }
+}
+
+ColumnarWriter::ColumnarWriter(uint32_t _schema, size_t _rowSize, std::vector<ColumnDef> _columns,
+                               ColumnarWriterConfig _config)
+    : schema(_schema),
+      rowSize(_rowSize),
+      columnDefs(std::move(_columns)),
+      config(std::move(_config)) {
+    config.rowGroupRows     = std::max<size_t>(config.rowGroupRows, 1);
+    config.maxPendingGroups = std::max<size_t>(config.maxPendingGroups, 1);
+
+    // Every group buffer is allocated here, once
+    current.rows.resize(config.rowGroupRows * rowSize);
+    spare.resize(config.maxPendingGroups);
+    for (auto& group : spare) group.rows.resize(config.rowGroupRows * rowSize);
+    filled.reserve(config.maxPendingGroups);
+}
+
+ColumnarWriter::~ColumnarWriter() {
+    close();
+}
+
+int ColumnarWriter::open(const std::string& path) {
+    close();
+
+    const int newFd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (newFd < 0) return errno;
+    fd = newFd;
+    fileOffset = 0;
+
+    std::vector<uint8_t> header(COLUMNAR_MAGIC, COLUMNAR_MAGIC + sizeof(COLUMNAR_MAGIC));
+    put<uint32_t>(header, COLUMNAR_VERSION);
+    put<uint32_t>(header, schema);
+    put<uint32_t>(header, static_cast<uint32_t>(columnDefs.size()));
+    for (const auto& column : columnDefs) {
+        const size_t length = std::min<size_t>(column.name.size(), 255);
+        put<uint8_t>(header, static_cast<uint8_t>(column.type));
+        put<uint8_t>(header, static_cast<uint8_t>(length));
+        header.insert(header.end(), column.name.begin(), column.name.begin() + static_cast<std::ptrdiff_t>(length));
+    }
+
+    if (!writeAll(header.data(), header.size())) {
+        const int err = errno;
+        ::close(fd);
+        fd = -1;
+        return err;
+    }
+
+    footer.clear();
+    current.count = 0;
+    stopping = false;
+    writer = std::thread([this]() { run(); });
+    return 0;
+}
+
+void ColumnarWriter::append(const void* row) {
+    if (fd < 0) [[unlikely]] return;
+
+    if (current.count == config.rowGroupRows) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (spare.empty()) {
+            if (config.dropWhenBusy) {
+                droppedRows.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            wakeProducer.wait(lock, [this]() { return !spare.empty(); });
+        }
+        filled.push_back(std::move(current));
+        current = std::move(spare.back());
+        spare.pop_back();
+        current.count = 0;
+        wakeWriter.notify_one();
+    }
+
+    std::memcpy(current.rows.data() + current.count * rowSize, row, rowSize);
+    ++current.count;
+    rows.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ColumnarWriter::flush() {
+    if (fd < 0 || current.count == 0) return;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    wakeProducer.wait(lock, [this]() { return !spare.empty(); });
+    filled.push_back(std::move(current));
+    current = std::move(spare.back());
+    spare.pop_back();
+    current.count = 0;
+    wakeWriter.notify_one();
+}
+
+void ColumnarWriter::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wakeWriter.wait(lock, [this]() { return stopping || !filled.empty(); });
+        if (filled.empty()) return;
+
+        Group group = std::move(filled.front());
+        filled.erase(filled.begin());
+
+        lock.unlock();
+        writeGroup(group);
+        lock.lock();
+
+        spare.push_back(std::move(group));
+        wakeProducer.notify_one();
+    }
+}
+
+/**
+ * @brief Transposes a group into column arrays and writes it with its
+ * statistics (writer thread).
+ */
+void ColumnarWriter::writeGroup(const Group& group) {
+    const size_t count = group.count;
+    const size_t headerSize = ROW_GROUP_HEADER_SIZE + columnDefs.size() * COLUMN_CHUNK_HEADER_SIZE;
+
+    size_t total = headerSize;
+    for (const auto& column : columnDefs) {
+        total += padTo8(count * columnTypeSize(column.type));
+    }
+    columnBuffer.assign(total, 0);
+
+    uint8_t* out = columnBuffer.data();
+    const auto rowCount = static_cast<uint32_t>(count);
+    std::memcpy(out, &rowCount, sizeof(rowCount));
+
+    size_t dataOffset = headerSize;
+    for (size_t c = 0; c < columnDefs.size(); ++c) {
+        const ColumnDef& column = columnDefs[c];
+        const uint8_t* rowData = group.rows.data();
+        uint8_t* dest = out + dataOffset;
+        double min = 0.0;
+        double max = 0.0;
+
+        switch (column.type) {
+            case ColumnType::U8:  transpose<uint8_t>(rowData, count, rowSize, column.offset, dest, min, max); break;
+            case ColumnType::I16: transpose<int16_t>(rowData, count, rowSize, column.offset, dest, min, max); break;
+            case ColumnType::U16: transpose<uint16_t>(rowData, count, rowSize, column.offset, dest, min, max); break;
+            case ColumnType::U32: transpose<uint32_t>(rowData, count, rowSize, column.offset, dest, min, max); break;
+            case ColumnType::F32: transpose<float>(rowData, count, rowSize, column.offset, dest, min, max); break;
+        }
+
+        const uint64_t bytes = count * columnTypeSize(column.type);
+        uint8_t* chunk = out + ROW_GROUP_HEADER_SIZE + c * COLUMN_CHUNK_HEADER_SIZE;
+        std::memcpy(chunk, &min, sizeof(min));
+        std::memcpy(chunk + 8, &max, sizeof(max));
+        std::memcpy(chunk + 16, &bytes, sizeof(bytes));
+
+        dataOffset += padTo8(static_cast<size_t>(bytes));
+    }
+
+    put<uint64_t>(footer, fileOffset);
+    put<uint32_t>(footer, rowCount);
+    put<uint32_t>(footer, 0);
+
+    if (!writeAll(columnBuffer.data(), columnBuffer.size())) {
+        writeErrors.fetch_add(1, std::memory_order_relaxed);
+    }
+    rowGroups.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool ColumnarWriter::writeAll(const void* bytes, size_t size) {
+    const auto* p = static_cast<const uint8_t*>(bytes);
+    while (size > 0) {
+        const ssize_t n = ::write(fd, p, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        p          += n;
+        size       -= static_cast<size_t>(n);
+        fileOffset += static_cast<uint64_t>(n);
+    }
+    return true;
+}
+
+int ColumnarWriter::close() {
+    if (fd < 0) return 0;
+
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeWriter.notify_one();
+    writer.join();
+
+    // The writer thread is gone: the footer is ours
+    const uint64_t footerOffset = fileOffset;
+    put<uint64_t>(footer, footerOffset);
+    footer.insert(footer.end(), FOOTER_MAGIC, FOOTER_MAGIC + sizeof(FOOTER_MAGIC));
+
+    int err = 0;
+    if (!writeAll(footer.data(), footer.size())) err = errno;
+    if (::fdatasync(fd) < 0 && err == 0) err = errno;
+    if (::close(fd) < 0 && err == 0) err = errno;
+    fd = -1;
+
+    if (err == 0 && writeErrors.load(std::memory_order_relaxed) > 0) err = EIO;
+    return err;
+}
+
+ColumnarWriterStats ColumnarWriter::getStats() const noexcept {
+    return {
+        rows.load(std::memory_order_relaxed),
+        rowGroups.load(std::memory_order_relaxed),
+        droppedRows.load(std::memory_order_relaxed),
+        writeErrors.load(std::memory_order_relaxed)
+    };
+}
+
+} // namespace ReactorAsterix::Export
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,251 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/export/NdjsonSerializer.h>
+
+// System headers
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+
+// Library headers
+#include <ReactorAsterix/cat001/Asterix1Report.h>
+#include <ReactorAsterix/cat002/Asterix2Report.h>
+
+namespace ReactorAsterix::Export {
+
+namespace {
+    /**
+     * @brief Bounded output cursor; the first overflow makes the line invalid.
+     */
+    class LineWriter {
+        public:
+            LineWriter(char* _out, size_t size) noexcept
+                : begin(_out), p(_out), end(_out + size) {
+            }
+
+            template <size_t N>
+            void literal(const char (&text)[N]) noexcept {
+                constexpr size_t length = N - 1;
+                if (!ok || static_cast<size_t>(end - p) < length) {
+                    ok = false;
+                    return;
+                }
+                std::memcpy(p, text, length);
+                p += length;
+            }
+
+            void integer(uint64_t value) noexcept {
+                if (!ok) return;
+                check(std::to_chars(p, end, value));
+            }
+
+            void integer(int64_t value) noexcept {
+                if (!ok) return;
+                check(std::to_chars(p, end, value));
+            }
+
+            // 'precision' decimals; non-finite values become null
+            void fixed(double value, int precision) noexcept {
+                if (!std::isfinite(value)) return literal("null");
+                if (!ok) return;
+                check(std::to_chars(p, end, value, std::chars_format::fixed, precision));
+            }
+
+            // Shortest representation that reads back to the same value
+            void shortest(double value) noexcept {
+                if (!std::isfinite(value)) return literal("null");
+                if (!ok) return;
+                check(std::to_chars(p, end, value));
+            }
+
+            void boolean(bool value) noexcept {
+                if (value) {
+                    literal("true");
+                } else {
+                    literal("false");
+                }
+            }
+
+            // Mode 3/A code as a quoted 4-digit octal string
+            void octal4(uint16_t code) noexcept {
+                if (!ok || end - p < 6) {
+                    ok = false;
+                    return;
+                }
+                p[0] = '"';
+                p[1] = static_cast<char>('0' + ((code >> 9) & 7));
+                p[2] = static_cast<char>('0' + ((code >> 6) & 7));
+                p[3] = static_cast<char>('0' + ((code >> 3) & 7));
+                p[4] = static_cast<char>('0' + (code & 7));
+                p[5] = '"';
+                p += 6;
+            }
+
+            size_t finish() noexcept {
+                literal("}\n");
+                return ok ? static_cast<size_t>(p - begin) : 0;
+            }
+
+        private:
+            void check(std::to_chars_result result) noexcept {
+                if (result.ec != std::errc()) {
+                    ok = false;
+                    return;
+                }
+                p = result.ptr;
+            }
+
+            char* const begin;
+            char* p;
+            char* const end;
+            bool ok{true};
+    };
+
+    void writeHeader(LineWriter& line, int category, const AsterixMessage& message) noexcept {
+        line.literal("{\"cat\":");
+        line.integer(static_cast<uint64_t>(category));
+        line.literal(",\"sac\":");
+        line.integer(static_cast<uint64_t>(message.sourceIdentifier.sac));
+        line.literal(",\"sic\":");
+        line.integer(static_cast<uint64_t>(message.sourceIdentifier.sic));
+        line.literal(",\"tod\":");
+        line.shortest(static_cast<double>(message.TOD) / 128.0);
+    }
+}
+
+NdjsonSerializer::NdjsonSerializer(size_t capacity)
+    : bufferSize(std::max(capacity, MAX_LINE_SIZE)),
+      buffer(std::make_unique<char[]>(bufferSize)) {
+}
+
+size_t NdjsonSerializer::format(const Asterix1Report& report, char* out, size_t size) noexcept {
+    LineWriter line(out, size);
+    writeHeader(line, 1, report);
+
+    line.literal(",\"ssrpsr\":");
+    line.integer(static_cast<uint64_t>(report.ssrpsr));
+    line.literal(",\"ds1ds2\":");
+    line.integer(static_cast<uint64_t>(report.ds1ds2));
+    line.literal(",\"spi\":");
+    line.boolean(report.spi);
+
+    if (report.hasPolarPosition) {
+        line.literal(",\"range\":");
+        line.fixed(report.range, 2);
+        line.literal(",\"azimuth\":");
+        line.fixed(report.azimuth, 6);
+    }
+
+    if (report.mode3A) {
+        line.literal(",\"mode3A\":");
+        line.octal4(report.mode3A->code);
+        line.literal(",\"mode3AV\":");
+        line.boolean(report.mode3A->validated);
+        line.literal(",\"mode3AG\":");
+        line.boolean(report.mode3A->garbled);
+        line.literal(",\"mode3AL\":");
+        line.boolean(report.mode3A->local);
+    }
+
+    if (report.ssrHeight) {
+        line.literal(",\"height\":");
+        line.fixed(report.ssrHeight->height, 2);
+        line.literal(",\"heightV\":");
+        line.boolean(report.ssrHeight->validated);
+        line.literal(",\"heightG\":");
+        line.boolean(report.ssrHeight->garbled);
+    }
+
+    if (report.hasLspClock) {
+        line.literal(",\"todLSP\":");
+        line.integer(static_cast<uint64_t>(report.todLSP));
+    }
+
+    return line.finish();
+}
+
+size_t NdjsonSerializer::format(const Asterix2Report& report, char* out, size_t size) noexcept {
+    LineWriter line(out, size);
+    writeHeader(line, 2, report);
+
+    line.literal(",\"type\":");
+    line.integer(static_cast<uint64_t>(report.messageType));
+
+    if (report.hasSectorNumber) {
+        line.literal(",\"sector\":");
+        line.integer(static_cast<uint64_t>(report.sectorNumber));
+    }
+
+    // Both come from I002/041
+    if (report.hasAntennaPeriod) {
+        line.literal(",\"period\":");
+        line.integer(static_cast<uint64_t>(report.antennaPeriod));
+        line.literal(",\"speed\":");
+        line.shortest(static_cast<double>(report.antennaSpeed));
+    }
+
+    return line.finish();
+}
+
+bool NdjsonSerializer::append(const Asterix1Report& report) noexcept {
+    const size_t written = format(report, buffer.get() + used, bufferSize - used);
+    used += written;
+    return written > 0;
+}
+
+bool NdjsonSerializer::append(const Asterix2Report& report) noexcept {
+    const size_t written = format(report, buffer.get() + used, bufferSize - used);
+    used += written;
+    return written > 0;
+}
+
+int NdjsonSerializer::flushTo(int fd) noexcept {
+    const char* p = buffer.get();
+    size_t left = used;
+    while (left > 0) {
+        const ssize_t n = ::write(fd, p, left);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            const int err = errno;
+            // Keep what was not written
+            std::memmove(buffer.get(), p, left);
+            used = left;
+            return err;
+        }
+        p    += n;
+        left -= static_cast<size_t>(n);
+    }
+    used = 0;
+    return 0;
+}
+
+} // namespace ReactorAsterix::Export
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/net/DatagramBatch.h>
+
+// System headers
+#include <cerrno>
+#include <cstring>
+
+namespace ReactorAsterix::Net {
+
+namespace {
+    // Room for one SCM_TIMESTAMPNS message per datagram
+    constexpr size_t CONTROL_SIZE = CMSG_SPACE(sizeof(struct timespec));
+
+    struct timespec extractTimestamp(const struct msghdr& msg) noexcept {
+        for (auto* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+             cmsg = CMSG_NXTHDR(const_cast<struct msghdr*>(&msg), cmsg)) {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+                struct timespec ts;
+                std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+                return ts;
+            }
+        }
+        return {};
+    }
+}
+
+DatagramBatch::DatagramBatch(size_t capacity, size_t _bufferSize)
+    : bufferSize(_bufferSize ? _bufferSize : 1),
+      payload(std::make_unique<uint8_t[]>((capacity ? capacity : 1) * bufferSize)),
+      control(std::make_unique<uint8_t[]>((capacity ? capacity : 1) * CONTROL_SIZE)),
+      headers(capacity ? capacity : 1),
+      iovecs(headers.size()),
+      views(headers.size()) {
+    for (size_t i = 0; i < headers.size(); ++i) {
+        iovecs[i].iov_base = payload.get() + i * bufferSize;
+        iovecs[i].iov_len  = bufferSize;
+
+        auto& msg = headers[i].msg_hdr;
+        std::memset(&msg, 0, sizeof(msg));
+        msg.msg_iov    = &iovecs[i];
+        msg.msg_iovlen = 1;
+    }
+}
+
+int DatagramBatch::receive(int fd, int flags) {
+    for (size_t i = 0; i < headers.size(); ++i) {
+        // The kernel overwrites these on every call
+        headers[i].msg_hdr.msg_control    = control.get() + i * CONTROL_SIZE;
+        headers[i].msg_hdr.msg_controllen = CONTROL_SIZE;
+        headers[i].msg_len = 0;
+    }
+
+    const int received = recvmmsg(fd, headers.data(), static_cast<unsigned int>(headers.size()),
+                                  flags, nullptr);
+    if (received < 0) {
+        return -errno;
+    }
+
+    int count = 0;
+    for (int i = 0; i < received; ++i) {
+        const auto& hdr = headers[static_cast<size_t>(i)];
+
+        if (hdr.msg_hdr.msg_flags & MSG_TRUNC) [[unlikely]] {
+            truncated.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        views[static_cast<size_t>(count++)] = {
+            static_cast<const uint8_t*>(hdr.msg_hdr.msg_iov->iov_base),
+            hdr.msg_len,
+            extractTimestamp(hdr.msg_hdr)
+        };
+    }
+
+    return count;
+}
+
+} // namespace ReactorAsterix::Net
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
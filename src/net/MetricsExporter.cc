@@ -0,0 +1,399 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/net/MetricsExporter.h>
+
+// System headers
+#include <arpa/inet.h>
+#include <cerrno>
+#include <charconv>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string_view>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <utility>
+
+namespace ReactorAsterix::Net {
+
+namespace {
+    constexpr size_t MAX_REQUEST_SIZE = 8192;
+
+    constexpr std::string_view CONTENT_TYPE = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+    struct GlobalCounter {
+        const char* name;
+        const char* help;
+        uint64_t AsterixStatsData::* field;
+    };
+
+    constexpr GlobalCounter GLOBAL_COUNTERS[] = {
+        {"asterix_packets", "Packets handed to the decoder", &AsterixStatsData::totalPackets},
+        {"asterix_trailing_bytes", "Bytes after the last complete data block", &AsterixStatsData::trailingBytesCount},
+        {"asterix_unhandled_categories", "Data blocks of unregistered categories", &AsterixStatsData::unhandledCategories},
+        {"asterix_malformed_blocks", "Data blocks with an invalid length", &AsterixStatsData::malformedBlocks},
+        {"asterix_malformed_records", "Records with a truncated item", &AsterixStatsData::malformedRecords},
+        {"asterix_record_parse_errors", "Records that could not be decoded", &AsterixStatsData::recordParseErrors},
+        {"asterix_protocol_violations", "Records missing a mandatory item", &AsterixStatsData::protocolViolations},
+        {"asterix_unhandled_items", "Items without a registered decoder", &AsterixStatsData::unhandledItems},
+        {"asterix_uninterpreted_items", "Items skipped without interpretation", &AsterixStatsData::uninterpretedItems}
+    };
+
+    struct CategoryCounter {
+        const char* name;
+        const char* help;
+        uint64_t AsterixCategoryStatsData::* field;
+    };
+
+    constexpr CategoryCounter CATEGORY_COUNTERS[] = {
+        {"asterix_category_blocks", "Data blocks per category", &AsterixCategoryStatsData::blocks},
+        {"asterix_category_records", "Decoded records per category", &AsterixCategoryStatsData::records},
+        {"asterix_category_bytes", "Data block bytes per category", &AsterixCategoryStatsData::bytes},
+        {"asterix_category_unhandled_blocks", "Data blocks without a handler", &AsterixCategoryStatsData::unhandledBlocks},
+        {"asterix_category_malformed_blocks", "Data blocks with an invalid length", &AsterixCategoryStatsData::malformedBlocks},
+        {"asterix_category_malformed_records", "Records with a truncated item", &AsterixCategoryStatsData::malformedRecords},
+        {"asterix_category_record_parse_errors", "Records that could not be decoded", &AsterixCategoryStatsData::recordParseErrors},
+        {"asterix_category_protocol_violations", "Records missing a mandatory item", &AsterixCategoryStatsData::protocolViolations},
+        {"asterix_category_unhandled_items", "Items without a registered decoder", &AsterixCategoryStatsData::unhandledItems}
+    };
+
+    // Exposed histogram bounds (ns): 1-2-5 steps from 1 us to 10 s
+    constexpr uint64_t LATENCY_BOUNDS[] = {
+        1'000, 2'000, 5'000, 10'000, 20'000, 50'000, 100'000, 200'000, 500'000,
+        1'000'000, 2'000'000, 5'000'000, 10'000'000, 20'000'000, 50'000'000,
+        100'000'000, 200'000'000, 500'000'000, 1'000'000'000, 2'000'000'000,
+        5'000'000'000, 10'000'000'000
+    };
+
+    // Everything one scrape needs from one handler
+    struct Collected {
+        std::string_view label;
+        AsterixStatsData stats;
+        std::vector<AsterixCategoryStatsData> categories;
+        std::vector<AsterixSourceStatsData> sources;
+        AsterixLatencyData latency;
+    };
+
+    void appendUint(std::string& out, uint64_t value) {
+        char buf[24];
+        const auto result = std::to_chars(buf, buf + sizeof(buf), value);
+        out.append(buf, result.ptr);
+    }
+
+    void appendSeconds(std::string& out, uint64_t nanos) {
+        char buf[32];
+        const auto result = std::to_chars(buf, buf + sizeof(buf), static_cast<double>(nanos) / 1e9);
+        out.append(buf, result.ptr);
+    }
+
+    void appendFamily(std::string& out, std::string_view name, std::string_view type, std::string_view help) {
+        out.append("# TYPE ").append(name).append(" ").append(type).append("\n");
+        out.append("# HELP ").append(name).append(" ").append(help).append("\n");
+    }
+
+    void appendHistogram(std::string& out, std::string_view label, const char* stage,
+                         const LatencySnapshot& snapshot) {
+        auto prefix = [&](const char* suffix) {
+            out.append("asterix_latency_seconds").append(suffix);
+            out.append("{handler=\"").append(label).append("\",stage=\"").append(stage).append("\"");
+        };
+
+        // Fine buckets are folded into the exposed bounds they fit under
+        uint64_t cumulative = 0;
+        size_t bucket = 0;
+        for (const uint64_t bound : LATENCY_BOUNDS) {
+            while (bucket < snapshot.buckets.size() && LatencyBuckets::upperBound(bucket) <= bound) {
+                cumulative += snapshot.buckets[bucket++];
+            }
+            prefix("_bucket");
+            out.append(",le=\"");
+            appendSeconds(out, bound);
+            out.append("\"} ");
+            appendUint(out, cumulative);
+            out.append("\n");
+        }
+        prefix("_bucket");
+        out.append(",le=\"+Inf\"} ");
+        appendUint(out, snapshot.count);
+        out.append("\n");
+
+        prefix("_count");
+        out.append("} ");
+        appendUint(out, snapshot.count);
+        out.append("\n");
+
+        prefix("_sum");
+        out.append("} ");
+        appendSeconds(out, snapshot.sumNanos);
+        out.append("\n");
+    }
+
+    std::string escapeLabel(std::string_view value) {
+        std::string out;
+        for (const char c : value) {
+            if (c == '\\' || c == '"') {
+                out.push_back('\\');
+                out.push_back(c);
+            } else if (c == '\n') {
+                out.append("\\n");
+            } else {
+                out.push_back(c);
+            }
+        }
+        return out;
+    }
+
+    bool sendAll(int fd, std::string_view data) {
+        while (!data.empty()) {
+            const ssize_t n = ::send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            data.remove_prefix(static_cast<size_t>(n));
+        }
+        return true;
+    }
+
+    void sendResponse(int fd, std::string_view status, std::string_view contentType, std::string_view body) {
+        std::string response("HTTP/1.1 ");
+        response.append(status).append("\r\nContent-Type: ").append(contentType);
+        response.append("\r\nContent-Length: ");
+        appendUint(response, body.size());
+        response.append("\r\nConnection: close\r\n\r\n");
+        response.append(body);
+        sendAll(fd, response);
+    }
+}
+
+MetricsExporter::MetricsExporter(MetricsExporterConfig _config)
+    : config(std::move(_config)) {}
+
+MetricsExporter::~MetricsExporter() {
+    stop();
+}
+
+void MetricsExporter::addHandler(const AsterixPacketHandler& handler, std::string label) {
+    sources.push_back({&handler, escapeLabel(label)});
+}
+
+int MetricsExporter::start() {
+    stop();
+
+    struct sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port   = htons(config.port);
+    if (inet_pton(AF_INET, config.bindAddress.c_str(), &addr.sin_addr) != 1) {
+        return EINVAL;
+    }
+
+    listenFd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listenFd < 0) return errno;
+
+    auto fail = [this]() {
+        const int err = errno;
+        stop();
+        return err;
+    };
+
+    const int one = 1;
+    if (setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) < 0) return fail();
+    if (::bind(listenFd, reinterpret_cast<const struct sockaddr*>(&addr), sizeof(addr)) < 0) return fail();
+    if (::listen(listenFd, 16) < 0) return fail();
+
+    stopFd = eventfd(0, EFD_CLOEXEC);
+    if (stopFd < 0) return fail();
+
+    thread = std::thread([this]() { run(); });
+    return 0;
+}
+
+void MetricsExporter::stop() {
+    if (thread.joinable()) {
+        const uint64_t one = 1;
+        [[maybe_unused]] const ssize_t n = ::write(stopFd, &one, sizeof(one));
+        thread.join();
+    }
+    if (stopFd >= 0) {
+        ::close(stopFd);
+        stopFd = -1;
+    }
+    if (listenFd >= 0) {
+        ::close(listenFd);
+        listenFd = -1;
+    }
+}
+
+uint16_t MetricsExporter::localPort() const noexcept {
+    struct sockaddr_in addr{};
+    socklen_t len = sizeof(addr);
+    if (listenFd < 0 || getsockname(listenFd, reinterpret_cast<struct sockaddr*>(&addr), &len) < 0) {
+        return 0;
+    }
+    return ntohs(addr.sin_port);
+}
+
+void MetricsExporter::run() {
+    struct pollfd fds[2] = {{listenFd, POLLIN, 0}, {stopFd, POLLIN, 0}};
+
+    while (true) {
+        if (::poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+        if (fds[1].revents) return;
+        if (!(fds[0].revents & POLLIN)) continue;
+
+        const int client = ::accept4(listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client < 0) continue;
+
+        serve(client);
+        ::close(client);
+    }
+}
+
+/**
+ * @brief Reads one request and answers it; the connection is then closed.
+ */
+void MetricsExporter::serve(int client) {
+    struct timeval tv{};
+    tv.tv_sec  = config.ioTimeoutMs / 1000;
+    tv.tv_usec = (config.ioTimeoutMs % 1000) * 1000;
+    setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+    std::string request;
+    char buf[1024];
+    while (request.find("\r\n\r\n") == std::string::npos) {
+        if (request.size() >= MAX_REQUEST_SIZE) {
+            return sendResponse(client, "431 Request Header Fields Too Large", "text/plain", "");
+        }
+        const ssize_t n = ::recv(client, buf, sizeof(buf), 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return;
+        request.append(buf, static_cast<size_t>(n));
+    }
+
+    // Request line: METHOD SP TARGET SP VERSION
+    const std::string_view line(request.data(), request.find("\r\n"));
+    const size_t methodEnd = line.find(' ');
+    const size_t targetEnd = line.find(' ', methodEnd + 1);
+    if (methodEnd == std::string_view::npos || targetEnd == std::string_view::npos) {
+        return sendResponse(client, "400 Bad Request", "text/plain", "");
+    }
+
+    const std::string_view method = line.substr(0, methodEnd);
+    std::string_view target = line.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+    target = target.substr(0, target.find('?'));
+
+    if (method != "GET") {
+        return sendResponse(client, "405 Method Not Allowed", "text/plain", "");
+    }
+    if (target != config.path) {
+        return sendResponse(client, "404 Not Found", "text/plain", "");
+    }
+
+    scrapeCount.fetch_add(1, std::memory_order_relaxed);
+    sendResponse(client, "200 OK", CONTENT_TYPE, render());
+}
+
+std::string MetricsExporter::render() const {
+    std::vector<Collected> collected;
+    collected.reserve(sources.size());
+    for (const auto& source : sources) {
+        collected.push_back({source.label,
+                             source.handler->getStatsSnapshot(),
+                             source.handler->getCategoryBreakdown(),
+                             source.handler->getSourceBreakdown(),
+                             source.handler->getLatencySnapshot()});
+    }
+
+    std::string out;
+    out.reserve(4096);
+
+    for (const auto& counter : GLOBAL_COUNTERS) {
+        appendFamily(out, counter.name, "counter", counter.help);
+        for (const auto& c : collected) {
+            out.append(counter.name).append("_total{handler=\"").append(c.label).append("\"} ");
+            appendUint(out, c.stats.*counter.field);
+            out.append("\n");
+        }
+    }
+
+    for (const auto& counter : CATEGORY_COUNTERS) {
+        appendFamily(out, counter.name, "counter", counter.help);
+        for (const auto& c : collected) {
+            for (const auto& category : c.categories) {
+                out.append(counter.name).append("_total{handler=\"").append(c.label).append("\",category=\"");
+                appendUint(out, category.category);
+                out.append("\"} ");
+                appendUint(out, category.*counter.field);
+                out.append("\n");
+            }
+        }
+    }
+
+    bool anySource = false;
+    for (const auto& c : collected) anySource = anySource || !c.sources.empty();
+    if (anySource) {
+        for (const bool errors : {false, true}) {
+            const char* name = errors ? "asterix_source_errors" : "asterix_source_records";
+            appendFamily(out, name, "counter", errors ? "Failed records per SAC/SIC" : "Decoded records per SAC/SIC");
+            for (const auto& c : collected) {
+                for (const auto& source : c.sources) {
+                    out.append(name).append("_total{handler=\"").append(c.label).append("\",sac=\"");
+                    appendUint(out, source.source.sac);
+                    out.append("\",sic=\"");
+                    appendUint(out, source.source.sic);
+                    out.append("\"} ");
+                    appendUint(out, errors ? source.errors : source.records);
+                    out.append("\n");
+                }
+            }
+        }
+    }
+
+    bool anyLatency = false;
+    for (const auto& c : collected) {
+        anyLatency = anyLatency || c.latency.receive.count || c.latency.decode.count || c.latency.listener.count;
+    }
+    if (anyLatency) {
+        appendFamily(out, "asterix_latency_seconds", "histogram",
+                     "Receive delay, block decode time and listener callback time");
+        for (const auto& c : collected) {
+            if (c.latency.receive.count)  appendHistogram(out, c.label, "receive", c.latency.receive);
+            if (c.latency.decode.count)   appendHistogram(out, c.label, "decode", c.latency.decode);
+            if (c.latency.listener.count) appendHistogram(out, c.label, "listener", c.latency.listener);
+        }
+    }
+
+    out.append("# EOF\n");
+    return out;
+}
+
+} // namespace ReactorAsterix::Net
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
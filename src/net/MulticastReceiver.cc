@@ -0,0 +1,277 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/net/MulticastReceiver.h>
+
+// System headers
+#include <arpa/inet.h>
+#include <cerrno>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <utility>
+
+// Library headers
+#include <ReactorAsterix/net/UdpReceiver.h>
+
+namespace ReactorAsterix::Net {
+
+namespace {
+    constexpr int MAX_EVENTS = 64;
+
+    // A subscription is drained for at most this many batches per poll(),
+    // so that one busy group cannot starve the others
+    constexpr int MAX_BATCHES_PER_SOCKET = 4;
+}
+
+MulticastReceiver::MulticastReceiver(MulticastReceiverConfig _config)
+    : config(std::move(_config)),
+      batch(config.batchSize, config.bufferSize),
+      epollFd(epoll_create1(EPOLL_CLOEXEC)) {
+    selected.reserve(batch.capacity());
+    compacted.reserve(batch.capacity() * config.bufferSize);
+}
+
+MulticastReceiver::~MulticastReceiver() {
+    for (auto& subscription : subscriptions) {
+        ::close(subscription->sock);
+    }
+    if (epollFd >= 0) ::close(epollFd);
+}
+
+int MulticastReceiver::subscribe(const MulticastSubscription& subscription) {
+    if (epollFd < 0) return -EBADF;
+    if (!subscription.handler) return -EINVAL;
+
+    struct in_addr groupAddr{};
+    struct in_addr ifaceAddr{};
+    if (inet_pton(AF_INET, subscription.group.c_str(), &groupAddr) != 1 ||
+        inet_pton(AF_INET, subscription.interfaceAddress.c_str(), &ifaceAddr) != 1) {
+        return -EINVAL;
+    }
+
+    // Binding to the group address keeps other groups on the same port out
+    UdpReceiverConfig socketConfig;
+    socketConfig.bindAddress        = subscription.group;
+    socketConfig.port               = subscription.port;
+    socketConfig.receiveBufferBytes = config.receiveBufferBytes;
+    socketConfig.pollTimeoutMs      = 0;
+    socketConfig.kernelTimestamps   = config.kernelTimestamps;
+    socketConfig.reuseAddress       = true;
+
+    const int fd = openUdpSocket(socketConfig);
+    if (fd < 0) return fd;
+
+    if (IN_MULTICAST(ntohl(groupAddr.s_addr))) {
+        struct ip_mreq mreq{};
+        mreq.imr_multiaddr = groupAddr;
+        mreq.imr_interface = ifaceAddr;
+        if (setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
+            const int err = errno;
+            ::close(fd);
+            return -err;
+        }
+    }
+
+    struct epoll_event event{};
+    event.events   = EPOLLIN;
+    event.data.u64 = subscriptions.size();
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+        const int err = errno;
+        ::close(fd);
+        return -err;
+    }
+
+    auto entry = std::make_unique<Subscription>();
+    entry->sock       = fd;
+    entry->handler    = subscription.handler;
+    entry->categories = subscription.categories;
+    entry->filtered   = subscription.categories.any();
+    subscriptions.push_back(std::move(entry));
+
+    return static_cast<int>(subscriptions.size() - 1);
+}
+
+int MulticastReceiver::poll() {
+    if (epollFd < 0) return -EBADF;
+
+    struct epoll_event events[MAX_EVENTS];
+    const int ready = epoll_wait(epollFd, events, MAX_EVENTS, config.pollTimeoutMs);
+    if (ready < 0) {
+        return errno == EINTR ? 0 : -errno;
+    }
+
+    int total = 0;
+    for (int i = 0; i < ready; ++i) {
+        total += drain(*subscriptions[events[i].data.u64]);
+    }
+    return total;
+}
+
+void MulticastReceiver::run(const std::atomic<bool>& stop) {
+    while (!stop.load(std::memory_order_relaxed)) {
+        if (poll() < 0) [[unlikely]] {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Reads the queued datagrams of one socket, batch by batch.
+ */
+int MulticastReceiver::drain(Subscription& subscription) {
+    int total = 0;
+    for (int round = 0; round < MAX_BATCHES_PER_SOCKET; ++round) {
+        const int count = batch.receive(subscription.sock, MSG_DONTWAIT);
+        if (count < 0) {
+            if (count != -EAGAIN && count != -EWOULDBLOCK && count != -EINTR) {
+                subscription.errors.fetch_add(1, std::memory_order_relaxed);
+            }
+            break;
+        }
+
+        dispatch(subscription, count);
+        total += count;
+
+        // A short batch means the queue is empty
+        if (static_cast<size_t>(count) < batch.capacity()) break;
+    }
+    return total;
+}
+
+/**
+ * @brief Hands a batch to the subscription handler, keeping only the
+ * selected categories.
+ *
+ * Data blocks are self-delimiting, so each datagram is passed on as one
+ * entry holding its selected blocks: a view into the batch buffer when they
+ * are contiguous, a copy in the compaction buffer otherwise. Anything that
+ * does not parse as a block is kept for the handler to account for; a
+ * datagram left empty is counted here and not passed on.
+ */
+void MulticastReceiver::dispatch(Subscription& subscription, int count) {
+    if (count <= 0) return;
+
+    const AsterixDatagram* datagrams = batch.datagrams();
+    subscription.datagrams.fetch_add(static_cast<uint64_t>(count), std::memory_order_relaxed);
+
+    if (!subscription.filtered) {
+        subscription.handler->handlePackets(datagrams, static_cast<size_t>(count));
+        return;
+    }
+
+    selected.clear();
+    compacted.clear();
+    uint64_t skippedBlocks = 0;
+    uint64_t skippedDatagrams = 0;
+
+    for (int i = 0; i < count; ++i) {
+        const AsterixDatagram& dgram = datagrams[i];
+        AsterixDatagram kept{nullptr, 0, dgram.ts};
+        const uint8_t* runStart = nullptr;
+        bool copied = false;
+        size_t pos = 0;
+
+        auto flush = [&](size_t end) {
+            if (!runStart) return;
+            const uint8_t* runEnd = dgram.data + end;
+            if (!kept.data) {
+                kept.data = runStart;
+            } else {
+                // A second run: move the first one to the compaction buffer.
+                // The buffer holds a whole batch, so it never reallocates.
+                if (!copied) {
+                    const size_t offset = compacted.size();
+                    compacted.insert(compacted.end(), kept.data, kept.data + kept.size);
+                    kept.data = compacted.data() + offset;
+                    copied = true;
+                }
+                compacted.insert(compacted.end(), runStart, runEnd);
+            }
+            kept.size += static_cast<size_t>(runEnd - runStart);
+            runStart = nullptr;
+        };
+
+        while (pos + 3 <= dgram.size) {
+            const uint8_t category = dgram.data[pos];
+            const size_t length = static_cast<size_t>((dgram.data[pos + 1] << 8) | dgram.data[pos + 2]);
+            if (length < 3 || pos + length > dgram.size) [[unlikely]] {
+                break;
+            }
+
+            if (subscription.categories.test(category)) {
+                if (!runStart) runStart = dgram.data + pos;
+            } else {
+                flush(pos);
+                ++skippedBlocks;
+            }
+            pos += length;
+        }
+
+        // Malformed or trailing bytes stay with the handler
+        if (pos < dgram.size && !runStart) runStart = dgram.data + pos;
+        flush(dgram.size);
+
+        if (kept.data) {
+            selected.push_back(kept);
+        } else {
+            ++skippedDatagrams;
+        }
+    }
+
+    if (skippedBlocks) subscription.filteredBlocks.fetch_add(skippedBlocks, std::memory_order_relaxed);
+    if (skippedDatagrams) subscription.filteredDatagrams.fetch_add(skippedDatagrams, std::memory_order_relaxed);
+    if (!selected.empty()) {
+        subscription.handler->handlePackets(selected.data(), selected.size());
+    }
+}
+
+uint16_t MulticastReceiver::localPort(size_t index) const noexcept {
+    if (index >= subscriptions.size()) return 0;
+
+    struct sockaddr_in addr{};
+    socklen_t len = sizeof(addr);
+    if (getsockname(subscriptions[index]->sock, reinterpret_cast<struct sockaddr*>(&addr), &len) < 0) {
+        return 0;
+    }
+    return ntohs(addr.sin_port);
+}
+
+MulticastSubscriptionStats MulticastReceiver::getStats(size_t index) const noexcept {
+    if (index >= subscriptions.size()) return {};
+
+    const Subscription& s = *subscriptions[index];
+    return {
+        s.datagrams.load(std::memory_order_relaxed),
+        s.filteredBlocks.load(std::memory_order_relaxed),
+        s.filteredDatagrams.load(std::memory_order_relaxed),
+        s.errors.load(std::memory_order_relaxed)
+    };
+}
+
+} // namespace ReactorAsterix::Net
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/net/ReusePortReceiverGroup.h>
+
+// System headers
+#include <algorithm>
+#include <pthread.h>
+#include <sched.h>
+#include <utility>
+
+namespace ReactorAsterix::Net {
+
+ReusePortReceiverGroup::ReusePortReceiverGroup(ReusePortGroupConfig _config, HandlerSetup _setup)
+    : config(std::move(_config)),
+      setup(std::move(_setup)) {
+    config.receiver.reusePort = true;
+    if (config.instances == 0) {
+        config.instances = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+ReusePortReceiverGroup::~ReusePortReceiverGroup() {
+    stop();
+}
+
+int ReusePortReceiverGroup::start() {
+    stop();
+    stopping.store(false, std::memory_order_relaxed);
+
+    UdpReceiverConfig receiverConfig = config.receiver;
+    for (size_t i = 0; i < config.instances; ++i) {
+        auto instance = std::make_unique<Instance>();
+        instance->handler = std::make_unique<AsterixPacketHandler>();
+        if (setup) setup(*instance->handler, i);
+
+        instance->receiver = std::make_unique<UdpReceiver>(*instance->handler, receiverConfig);
+        const int err = instance->receiver->open();
+        if (err != 0) {
+            instances.clear();
+            return err;
+        }
+
+        // Later sockets join the port picked by the first one
+        if (i == 0) receiverConfig.port = instance->receiver->localPort();
+
+        if (config.pinThreads) {
+            instance->cpu = i < config.cpus.size() ? config.cpus[i] : static_cast<int>(i);
+        }
+        instances.push_back(std::move(instance));
+    }
+
+    // All sockets are in the reuseport group before any is read from
+    for (auto& instance : instances) {
+        Instance* ptr = instance.get();
+        ptr->thread = std::thread([this, ptr]() { runInstance(*ptr); });
+    }
+    return 0;
+}
+
+void ReusePortReceiverGroup::stop() {
+    stopping.store(true, std::memory_order_relaxed);
+    for (auto& instance : instances) {
+        if (instance->thread.joinable()) instance->thread.join();
+    }
+    instances.clear();
+}
+
+void ReusePortReceiverGroup::runInstance(Instance& instance) {
+    if (instance.cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(static_cast<size_t>(instance.cpu), &set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+            // Best effort: keep running unpinned (e.g. CPU offline or restricted)
+            unpinned.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    instance.receiver->run(stopping);
+}
+
+uint16_t ReusePortReceiverGroup::localPort() const noexcept {
+    return instances.empty() ? 0 : instances.front()->receiver->localPort();
+}
+
+AsterixStatsData ReusePortReceiverGroup::getStatsSnapshot() const {
+    AsterixStatsData total{};
+    for (const auto& instance : instances) {
+        total += instance->handler->getStatsSnapshot();
+    }
+    return total;
+}
+
+AsterixLatencyData ReusePortReceiverGroup::getLatencySnapshot() const {
+    AsterixLatencyData total{};
+    for (const auto& instance : instances) {
+        total += instance->handler->getLatencySnapshot();
+    }
+    return total;
+}
+
+UdpReceiverStats ReusePortReceiverGroup::getReceiverStats() const {
+    UdpReceiverStats total{};
+    for (const auto& instance : instances) {
+        const UdpReceiverStats s = instance->receiver->getStats();
+        total.datagrams += s.datagrams;
+        total.batches   += s.batches;
+        total.truncated += s.truncated;
+        total.errors    += s.errors;
+        total.failed    += s.failed;
+    }
+    return total;
+}
+
+} // namespace ReactorAsterix::Net
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
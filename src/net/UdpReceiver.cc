@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/net/UdpReceiver.h>
+
+// System headers
+#include <arpa/inet.h>
+#include <cerrno>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <utility>
+
+namespace ReactorAsterix::Net {
+
+int openUdpSocket(const UdpReceiverConfig& config) {
+    struct sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port   = htons(config.port);
+    if (inet_pton(AF_INET, config.bindAddress.c_str(), &addr.sin_addr) != 1) {
+        return -EINVAL;
+    }
+
+    const int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -errno;
+
+    auto fail = [fd]() {
+        const int err = errno;
+        ::close(fd);
+        return -err;
+    };
+
+    const int one = 1;
+    if (config.reusePort &&
+        setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one)) < 0) {
+        return fail();
+    }
+
+    if (config.reuseAddress &&
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) < 0) {
+        return fail();
+    }
+
+    if (config.kernelTimestamps &&
+        setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &one, sizeof(one)) < 0) {
+        return fail();
+    }
+
+    if (config.receiveBufferBytes > 0) {
+        // Best effort: capped by net.core.rmem_max
+        setsockopt(fd, SOL_SOCKET, SO_RCVBUF,
+                   &config.receiveBufferBytes, sizeof(config.receiveBufferBytes));
+    }
+
+    if (config.pollTimeoutMs > 0) {
+        struct timeval tv{};
+        tv.tv_sec  = config.pollTimeoutMs / 1000;
+        tv.tv_usec = (config.pollTimeoutMs % 1000) * 1000;
+        if (setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) < 0) {
+            return fail();
+        }
+    }
+
+    if (::bind(fd, reinterpret_cast<const struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+        return fail();
+    }
+
+    return fd;
+}
+
+UdpReceiver::UdpReceiver(AsterixPacketHandler& _handler, UdpReceiverConfig _config)
+    : handler(_handler),
+      config(std::move(_config)),
+      batch(config.batchSize, config.bufferSize) {}
+
+UdpReceiver::~UdpReceiver() {
+    close();
+}
+
+int UdpReceiver::open() {
+    close();
+
+    // Without a receive timeout run() would block and never see 'stop'
+    if (config.pollTimeoutMs <= 0) return EINVAL;
+
+    const int fd = openUdpSocket(config);
+    if (fd < 0) return -fd;
+
+    sock = fd;
+    failed.store(0, std::memory_order_relaxed);
+    return 0;
+}
+
+void UdpReceiver::close() noexcept {
+    if (sock >= 0) {
+        ::close(sock);
+        sock = -1;
+    }
+}
+
+/**
+ * @brief Blocks (up to SO_RCVTIMEO) for the first datagram, then takes
+ * whatever else is already queued, in a single system call.
+ */
+int UdpReceiver::poll() {
+    if (sock < 0) return -EBADF;
+
+    const int count = batch.receive(sock, MSG_WAITFORONE);
+    if (count < 0) {
+        if (count == -EAGAIN || count == -EWOULDBLOCK || count == -EINTR) {
+            return 0;
+        }
+        errors.fetch_add(1, std::memory_order_relaxed);
+        return count;
+    }
+
+    if (count > 0) {
+        handler.handlePackets(batch.datagrams(), static_cast<size_t>(count));
+
+        datagrams.fetch_add(static_cast<uint64_t>(count), std::memory_order_relaxed);
+        batches.fetch_add(1, std::memory_order_relaxed);
+    }
+    return count;
+}
+
+void UdpReceiver::run(const std::atomic<bool>& stop) {
+    while (!stop.load(std::memory_order_relaxed)) {
+        if (poll() < 0) [[unlikely]] {
+            // Persistent socket error: do not spin, report the receiver as failed
+            failed.store(1, std::memory_order_relaxed);
+            break;
+        }
+    }
+}
+
+uint16_t UdpReceiver::localPort() const noexcept {
+    struct sockaddr_in addr{};
+    socklen_t len = sizeof(addr);
+    if (sock < 0 || getsockname(sock, reinterpret_cast<struct sockaddr*>(&addr), &len) < 0) {
+        return 0;
+    }
+    return ntohs(addr.sin_port);
+}
+
+UdpReceiverStats UdpReceiver::getStats() const noexcept {
+    return {
+        datagrams.load(std::memory_order_relaxed),
+        batches.load(std::memory_order_relaxed),
+        batch.truncatedCount(),
+        errors.load(std::memory_order_relaxed),
+        failed.load(std::memory_order_relaxed)
+    };
+}
+
+} // namespace ReactorAsterix::Net
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,355 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/recording/AsterixFileReader.h>
+
+// System headers
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace ReactorAsterix::Recording {
+
+namespace {
+    // Largest record accepted; ASTERIX blocks are at most 65535 bytes
+    constexpr size_t MAX_RECORD_SIZE = 1 << 17;
+
+    // Records checked by framing detection
+    constexpr int DETECT_RECORDS = 4;
+
+    uint64_t readUint(const uint8_t* p, size_t size, bool bigEndian) noexcept {
+        uint64_t value = 0;
+        for (size_t i = 0; i < size; ++i) {
+            value = (value << 8) | p[bigEndian ? i : size - 1 - i];
+        }
+        return value;
+    }
+
+    /**
+     * @brief Whole record size from its header, 0 if implausible.
+     */
+    size_t recordSize(const FramingSpec& spec, const uint8_t* header) noexcept {
+        const auto length = static_cast<size_t>(readUint(header + spec.lengthOffset, spec.lengthSize,
+                                                         spec.lengthBigEndian));
+        const size_t framing = spec.headerSize + spec.trailerSize;
+        const size_t total = spec.lengthIncludesFraming ? length : length + framing;
+
+        if (total < framing || total > MAX_RECORD_SIZE) return 0;
+        return total;
+    }
+
+    /**
+     * @brief Whether 'size' bytes are exactly a chain of data blocks.
+     */
+    bool isBlockChain(const uint8_t* p, size_t size) noexcept {
+        size_t pos = 0;
+        while (pos + 3 <= size) {
+            const size_t length = static_cast<size_t>((p[pos + 1] << 8) | p[pos + 2]);
+            if (p[pos] == 0 || length < 3) return false;
+            pos += length;
+        }
+        return pos == size && size > 0;
+    }
+
+    bool looksFramed(const FramingSpec& spec, const uint8_t* p, size_t size) noexcept {
+        size_t pos = 0;
+        int checked = 0;
+        while (checked < DETECT_RECORDS && pos + spec.headerSize <= size) {
+            const size_t total = recordSize(spec, p + pos);
+            if (total == 0 || total == spec.headerSize + spec.trailerSize) return false;
+            if (pos + total > size) break;
+
+            const uint8_t* payload = p + pos + spec.headerSize;
+            if (!isBlockChain(payload, total - spec.headerSize - spec.trailerSize)) return false;
+
+            if (spec.checkTrailer) {
+                const uint8_t* trailer = payload + total - spec.headerSize - spec.trailerSize;
+                for (size_t i = 0; i < spec.trailerSize; ++i) {
+                    if (trailer[i] != spec.trailerByte) return false;
+                }
+            }
+
+            pos += total;
+            ++checked;
+        }
+        return checked > 0;
+    }
+
+    bool looksRaw(const uint8_t* p, size_t size, bool complete) noexcept {
+        size_t pos = 0;
+        int checked = 0;
+        while (checked < DETECT_RECORDS && pos + 3 <= size) {
+            const size_t length = static_cast<size_t>((p[pos + 1] << 8) | p[pos + 2]);
+            if (p[pos] == 0 || length < 3) return false;
+            if (pos + length > size) return !complete && checked > 0;
+            pos += length;
+            ++checked;
+        }
+        return checked > 0 && (checked == DETECT_RECORDS || pos == size || !complete);
+    }
+}
+
+FramingSpec FramingSpec::finalPreset() noexcept {
+    FramingSpec spec;
+    spec.headerSize      = 8;
+    spec.trailerSize     = 4;
+    spec.lengthOffset    = 0;
+    spec.lengthSize      = 2;
+    spec.lengthBigEndian = true;
+    spec.timeOffset      = 5;
+    spec.timeSize        = 3;
+    spec.timeBigEndian   = true;
+    spec.timeUnitNs      = 10'000'000;
+    spec.trailerByte     = 0xA5;
+    spec.checkTrailer    = true;
+    return spec;
+}
+
+FramingSpec FramingSpec::iossPreset() noexcept {
+    FramingSpec spec;
+    spec.headerSize      = 8;
+    spec.trailerSize     = 0;
+    spec.lengthOffset    = 0;
+    spec.lengthSize      = 2;
+    spec.lengthBigEndian = false;
+    spec.timeOffset      = 4;
+    spec.timeSize        = 4;
+    spec.timeBigEndian   = false;
+    spec.timeUnitNs      = 10'000'000;
+    return spec;
+}
+
+AsterixFileReader::AsterixFileReader(AsterixFileReaderConfig _config)
+    : config(std::move(_config)) {
+    // A record cut by the end of a read always fits in front of the next one
+    config.chunkSize = std::max(config.chunkSize, 2 * MAX_RECORD_SIZE);
+}
+
+AsterixFileReader::~AsterixFileReader() {
+    close();
+}
+
+int AsterixFileReader::open(const std::string& path) {
+    close();
+
+    fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return errno;
+
+    stats = {};
+    pos = end = 0;
+    eof = false;
+    readError = 0;
+
+    if (config.useMmap) {
+        struct stat st{};
+        if (fstat(fd, &st) < 0) {
+            const int err = errno;
+            close();
+            return err;
+        }
+        mappedSize = static_cast<size_t>(st.st_size);
+        if (mappedSize > 0) {
+            void* map = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED) {
+                const int err = errno;
+                mappedSize = 0;
+                close();
+                return err;
+            }
+            madvise(map, mappedSize, MADV_SEQUENTIAL);
+            data = static_cast<const uint8_t*>(map);
+        }
+        end = mappedSize;
+        eof = true;
+    } else {
+        if (!buffer) buffer = std::make_unique<uint8_t[]>(config.chunkSize);
+        data = buffer.get();
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+
+    switch (config.framing) {
+        case FileFraming::FINAL:  spec = FramingSpec::finalPreset(); detected = FileFraming::FINAL; break;
+        case FileFraming::IOSS:   spec = FramingSpec::iossPreset(); detected = FileFraming::IOSS; break;
+        case FileFraming::CUSTOM:
+            spec = config.custom;
+            if (spec.lengthSize == 0 || spec.lengthSize > 4 ||
+                spec.lengthOffset + spec.lengthSize > spec.headerSize ||
+                spec.timeOffset + spec.timeSize > spec.headerSize || spec.timeSize > 8) {
+                close();
+                return EINVAL;
+            }
+            detected = FileFraming::CUSTOM;
+            break;
+        case FileFraming::RAW:    detected = FileFraming::RAW; break;
+        case FileFraming::AUTO:   detected = detect(); break;
+    }
+
+    if (readError != 0 || detected == FileFraming::AUTO) {
+        const int err = readError != 0 ? readError : EBADMSG;
+        close();
+        return err;
+    }
+    return 0;
+}
+
+void AsterixFileReader::close() noexcept {
+    if (mappedSize > 0) {
+        munmap(const_cast<uint8_t*>(data), mappedSize);
+        mappedSize = 0;
+    }
+    data = nullptr;
+    pos = end = 0;
+
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+/**
+ * @brief Tries the framings from the most to the least constrained on the
+ * first records of the file.
+ */
+FileFraming AsterixFileReader::detect() {
+    // Fills the buffer (or does nothing when mapped)
+    ensure(MAX_RECORD_SIZE);
+    const uint8_t* window = data + pos;
+    const size_t size = end - pos;
+
+    if (size == 0) return FileFraming::RAW;
+
+    for (const FileFraming candidate : {FileFraming::FINAL, FileFraming::IOSS}) {
+        const FramingSpec candidateSpec = candidate == FileFraming::FINAL ? FramingSpec::finalPreset()
+                                                                          : FramingSpec::iossPreset();
+        if (looksFramed(candidateSpec, window, size)) {
+            spec = candidateSpec;
+            return candidate;
+        }
+    }
+
+    return looksRaw(window, size, eof) ? FileFraming::RAW : FileFraming::AUTO;
+}
+
+/**
+ * @brief Makes 'count' bytes available at pos, reading more of the file if
+ * needed.
+ * @return nullptr at the end of the file or on a read error.
+ */
+const uint8_t* AsterixFileReader::ensure(size_t count) {
+    if (end - pos >= count) return data + pos;
+    if (eof || readError != 0) return nullptr;
+
+    // Move the partial record to the front and fill the rest of the buffer
+    uint8_t* buf = buffer.get();
+    std::memmove(buf, buf + pos, end - pos);
+    end -= pos;
+    pos  = 0;
+
+    while (end < config.chunkSize) {
+        const ssize_t n = ::read(fd, buf + end, config.chunkSize - end);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            readError = errno;
+            break;
+        }
+        if (n == 0) {
+            eof = true;
+            break;
+        }
+        end += static_cast<size_t>(n);
+    }
+
+    return end - pos >= count ? data + pos : nullptr;
+}
+
+int AsterixFileReader::next(AsterixDatagram& out) {
+    if (fd < 0) return -EBADF;
+
+    auto endOfData = [this]() {
+        if (readError != 0) return -readError;
+        stats.truncatedTail = end - pos;
+        pos = end;
+        return 0;
+    };
+
+    if (detected == FileFraming::RAW) {
+        const uint8_t* header = ensure(3);
+        if (!header) return endOfData();
+
+        const size_t length = static_cast<size_t>((header[1] << 8) | header[2]);
+        if (length < 3) [[unlikely]] return -EBADMSG;
+
+        const uint8_t* block = ensure(length);
+        if (!block) return endOfData();
+
+        out = {block, length, {}};
+        pos += length;
+    } else {
+        const uint8_t* header = ensure(spec.headerSize);
+        if (!header) return endOfData();
+
+        const size_t total = recordSize(spec, header);
+        if (total == 0) [[unlikely]] return -EBADMSG;
+
+        const uint8_t* record = ensure(total);
+        if (!record) return endOfData();
+
+        struct timespec ts{};
+        if (spec.timeSize > 0) {
+            const uint64_t nanos = readUint(record + spec.timeOffset, spec.timeSize, spec.timeBigEndian)
+                                   * spec.timeUnitNs;
+            ts.tv_sec  = static_cast<time_t>(nanos / 1'000'000'000ULL);
+            ts.tv_nsec = static_cast<long>(nanos % 1'000'000'000ULL);
+        }
+
+        out = {record + spec.headerSize, total - spec.headerSize - spec.trailerSize, ts};
+        pos += total;
+    }
+
+    ++stats.records;
+    stats.bytes += out.size;
+    return 1;
+}
+
+int64_t AsterixFileReader::feed(AsterixPacketHandler& handler) {
+    int64_t count = 0;
+    AsterixDatagram record{};
+
+    int ret;
+    while ((ret = next(record)) > 0) {
+        handler.handlePacket(record.data, record.size, record.ts);
+        ++count;
+    }
+    return ret < 0 ? ret : count;
+}
+
+} // namespace ReactorAsterix::Recording
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,521 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/recording/Recorder.h>
+
+// System headers
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <fcntl.h>
+#include <mutex>
+#include <sys/uio.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+
+#ifdef REACTORASTERIX_HAVE_LIBURING
+#include <liburing.h>
+#endif
+
+// Library headers
+#include <ReactorAsterix/recording/RecordingFormat.h>
+
+namespace ReactorAsterix::Recording {
+
+namespace {
+    /**
+     * @brief Writes all of 'data' at 'offset', retrying short writes.
+     * @return 0 on success, an errno value otherwise.
+     */
+    int pwriteAll(int fd, const uint8_t* data, size_t size, uint64_t offset) {
+        while (size > 0) {
+            const ssize_t n = ::pwrite(fd, data, size, static_cast<off_t>(offset));
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return errno;
+            }
+            data   += n;
+            size   -= static_cast<size_t>(n);
+            offset += static_cast<uint64_t>(n);
+        }
+        return 0;
+    }
+}
+
+namespace detail {
+
+/**
+ * @brief One write of a buffer job.
+ */
+struct WriteRange {
+    const uint8_t* data{nullptr};
+    size_t size{0};
+    uint64_t offset{0};
+};
+
+/**
+ * @brief Asynchronous writer of whole buffers.
+ *
+ * A job writes a data buffer to the recording and, when not empty, the
+ * index entries of its frames to the index file. submit() never blocks;
+ * reap() collects the indexes of the buffers whose job has completed,
+ * optionally waiting for at least one.
+ */
+class WriteBackend {
+    public:
+        virtual ~WriteBackend() = default;
+
+        [[nodiscard]] virtual int submit(size_t index, const WriteRange& data, const WriteRange& entries) = 0;
+        virtual void reap(bool wait, std::vector<size_t>& completed, uint64_t& errors) = 0;
+        [[nodiscard]] virtual size_t inFlight() const noexcept = 0;
+        [[nodiscard]] virtual bool isIoUring() const noexcept = 0;
+};
+
+} // namespace detail
+
+namespace {
+
+/**
+ * @brief Fallback: a writer thread performing pwrite() calls.
+ */
+class ThreadWriteBackend final : public detail::WriteBackend {
+    public:
+        ThreadWriteBackend(int _fd, int _indexFd, size_t capacity) : fd(_fd), indexFd(_indexFd) {
+            pending.reserve(capacity);
+            done.reserve(capacity);
+            worker = std::thread([this]() { run(); });
+        }
+
+        ~ThreadWriteBackend() override {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wakeWorker.notify_one();
+            worker.join();
+        }
+
+        int submit(size_t index, const detail::WriteRange& data, const detail::WriteRange& entries) override {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                pending.push_back({index, data, entries});
+                ++outstanding;
+            }
+            wakeWorker.notify_one();
+            return 0;
+        }
+
+        void reap(bool wait, std::vector<size_t>& completed, uint64_t& errors) override {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (wait) {
+                wakeWaiter.wait(lock, [this]() { return !done.empty() || outstanding == 0; });
+            }
+            for (size_t index : done) completed.push_back(index);
+            outstanding -= done.size();
+            done.clear();
+
+            errors += failures;
+            failures = 0;
+        }
+
+        size_t inFlight() const noexcept override {
+            std::lock_guard<std::mutex> lock(mutex);
+            return outstanding;
+        }
+
+        bool isIoUring() const noexcept override { return false; }
+
+    private:
+        struct Job {
+            size_t index;
+            detail::WriteRange data;
+            detail::WriteRange entries;
+        };
+
+        void run() {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                wakeWorker.wait(lock, [this]() { return stopping || !pending.empty(); });
+                if (pending.empty()) return;
+
+                const Job job = pending.front();
+                pending.erase(pending.begin());
+
+                lock.unlock();
+                int errors = pwriteAll(fd, job.data.data, job.data.size, job.data.offset) != 0;
+                if (job.entries.size > 0 &&
+                    pwriteAll(indexFd, job.entries.data, job.entries.size, job.entries.offset) != 0) {
+                    ++errors;
+                }
+                lock.lock();
+
+                failures += static_cast<uint64_t>(errors);
+                done.push_back(job.index);
+                wakeWaiter.notify_all();
+            }
+        }
+
+        int fd;
+        int indexFd;
+        mutable std::mutex mutex;
+        std::condition_variable wakeWorker;
+        std::condition_variable wakeWaiter;
+
+        std::vector<Job> pending;
+        std::vector<size_t> done;
+        size_t outstanding{0};
+        uint64_t failures{0};
+        bool stopping{false};
+
+        std::thread worker;
+};
+
+#ifdef REACTORASTERIX_HAVE_LIBURING
+/**
+ * @brief io_uring writer using registered (fixed) buffers.
+ *
+ * The index entries of a buffer go in a second SQE; user_data carries the
+ * buffer index and the part (0: data, 1: entries), and the buffer completes
+ * with its last part.
+ */
+class UringWriteBackend final : public detail::WriteBackend {
+    public:
+        /**
+         * @return nullptr if the ring cannot be created (old kernel, seccomp).
+         */
+        static std::unique_ptr<UringWriteBackend> create(int fd, int indexFd, uint8_t* storage,
+                                                         size_t bufferSize, size_t count) {
+            auto backend = std::unique_ptr<UringWriteBackend>(new UringWriteBackend(fd, indexFd, count));
+            if (io_uring_queue_init(static_cast<unsigned>(2 * count), &backend->ring, 0) < 0) {
+                return nullptr;
+            }
+            backend->initialized = true;
+
+            std::vector<struct iovec> iovecs(count);
+            for (size_t i = 0; i < count; ++i) {
+                iovecs[i].iov_base = storage + i * bufferSize;
+                iovecs[i].iov_len  = bufferSize;
+            }
+            if (io_uring_register_buffers(&backend->ring, iovecs.data(),
+                                          static_cast<unsigned>(count)) < 0) {
+                return nullptr;
+            }
+            return backend;
+        }
+
+        ~UringWriteBackend() override {
+            if (!initialized) return;
+            std::vector<size_t> ignored;
+            uint64_t errors = 0;
+            while (outstanding > 0) reap(true, ignored, errors);
+            io_uring_queue_exit(&ring);
+        }
+
+        int submit(size_t index, const detail::WriteRange& data, const detail::WriteRange& entries) override {
+            const unsigned parts = entries.size > 0 ? 2 : 1;
+            if (io_uring_sq_space_left(&ring) < parts) return EBUSY;
+
+            struct io_uring_sqe* sqe = io_uring_get_sqe(&ring);
+            io_uring_prep_write_fixed(sqe, fd, data.data, static_cast<unsigned>(data.size),
+                                      data.offset, static_cast<int>(index));
+            sqe->user_data = index * 2;
+
+            if (entries.size > 0) {
+                sqe = io_uring_get_sqe(&ring);
+                io_uring_prep_write(sqe, indexFd, entries.data, static_cast<unsigned>(entries.size),
+                                    entries.offset);
+                sqe->user_data = index * 2 + 1;
+            }
+            jobs[index] = {{data, entries}, parts};
+
+            const int ret = io_uring_submit(&ring);
+            if (ret < 0) return -ret;
+
+            ++outstanding;
+            return 0;
+        }
+
+        void reap(bool wait, std::vector<size_t>& completed, uint64_t& errors) override {
+            struct io_uring_cqe* cqe = nullptr;
+            if (wait && outstanding > 0) {
+                while (io_uring_wait_cqe(&ring, &cqe) == -EINTR) {}
+            }
+
+            while (io_uring_peek_cqe(&ring, &cqe) == 0 && cqe) {
+                const auto index = static_cast<size_t>(cqe->user_data / 2);
+                const auto part  = static_cast<size_t>(cqe->user_data % 2);
+                Job& job = jobs[index];
+                const detail::WriteRange& range = job.ranges[part];
+
+                if (cqe->res < 0) {
+                    ++errors;
+                } else if (static_cast<size_t>(cqe->res) < range.size) {
+                    // Rare on regular files: finish the write synchronously
+                    const auto written = static_cast<size_t>(cqe->res);
+                    if (pwriteAll(part == 0 ? fd : indexFd, range.data + written,
+                                  range.size - written, range.offset + written) != 0) {
+                        ++errors;
+                    }
+                }
+
+                io_uring_cqe_seen(&ring, cqe);
+                if (--job.parts == 0) {
+                    completed.push_back(index);
+                    --outstanding;
+                }
+            }
+        }
+
+        size_t inFlight() const noexcept override { return outstanding; }
+
+        bool isIoUring() const noexcept override { return true; }
+
+    private:
+        struct Job {
+            detail::WriteRange ranges[2];
+            unsigned parts{0};
+        };
+
+        UringWriteBackend(int _fd, int _indexFd, size_t count) : fd(_fd), indexFd(_indexFd), jobs(count) {}
+
+        int fd;
+        int indexFd;
+        struct io_uring ring{};
+        bool initialized{false};
+        std::vector<Job> jobs;
+        size_t outstanding{0};
+};
+#endif
+
+} // namespace
+
+Recorder::Recorder(RecorderConfig _config)
+    : config(std::move(_config)) {
+    config.bufferSize  = std::max(config.bufferSize, FRAME_HEADER_SIZE + MAX_FRAME_SIZE);
+    config.bufferCount = std::max<size_t>(config.bufferCount, 2);
+    config.indexIntervalNs = std::max<uint64_t>(config.indexIntervalNs, 1);
+
+    storage = std::make_unique<uint8_t[]>(config.bufferSize * config.bufferCount);
+    indexStorage = std::make_unique<uint8_t[]>(INDEX_BYTES_PER_BUFFER * config.bufferCount);
+    freeBuffers.reserve(config.bufferCount);
+}
+
+Recorder::~Recorder() {
+    close();
+}
+
+int Recorder::open(const std::string& path) {
+    close();
+
+    const int newFd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (newFd < 0) return errno;
+
+    uint8_t header[FILE_HEADER_SIZE] = {};
+    std::memcpy(header, MAGIC, sizeof(MAGIC));
+    writeLe32(header + 8, VERSION);
+
+    int err = pwriteAll(newFd, header, sizeof(header), 0);
+    if (err != 0) {
+        ::close(newFd);
+        return err;
+    }
+
+    if (config.writeIndex) {
+        indexFd = ::open(indexPath(path).c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        std::memcpy(header, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+        err = indexFd < 0 ? errno : pwriteAll(indexFd, header, sizeof(header), 0);
+        if (err != 0) {
+            if (indexFd >= 0) ::close(indexFd);
+            indexFd = -1;
+            ::close(newFd);
+            return err;
+        }
+        indexOffset      = FILE_HEADER_SIZE;
+        nextIndexNanos   = 0;
+        lastIndexedNanos = 0;
+        lastIndexedFrame = FILE_HEADER_SIZE;
+    }
+
+#ifdef REACTORASTERIX_HAVE_LIBURING
+    if (config.useIoUring) {
+        backend = UringWriteBackend::create(newFd, indexFd, storage.get(), config.bufferSize, config.bufferCount);
+    }
+#endif
+    if (!backend) {
+        backend = std::make_unique<ThreadWriteBackend>(newFd, indexFd, config.bufferCount);
+    }
+
+    fd         = newFd;
+    fileOffset = FILE_HEADER_SIZE;
+
+    freeBuffers.clear();
+    for (size_t i = config.bufferCount; i-- > 1;) freeBuffers.push_back(i);
+    active     = 0;
+    activeUsed = 0;
+    indexUsed  = 0;
+    return 0;
+}
+
+bool Recorder::record(const uint8_t data[], size_t size, const struct timespec& ts) {
+    if (fd < 0 || size > MAX_FRAME_SIZE) [[unlikely]] {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    const size_t needed = FRAME_HEADER_SIZE + size;
+    if (activeUsed + needed > config.bufferSize) {
+        if (!nextBuffer()) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    const uint64_t nanos = toNanos(ts);
+    if (indexFd >= 0 && indexUsed < INDEX_BYTES_PER_BUFFER) {
+        // First frame of every period (or of every indexIntervalBytes).
+        // Entries past the capacity of the buffer are left to the next one,
+        // and after a backward clock step none is added until the time is
+        // back to the last indexed one, so that the index stays sorted.
+        const uint64_t frameOffset = fileOffset + activeUsed;
+        if (nanos >= nextIndexNanos ||
+            (frameOffset - lastIndexedFrame >= config.indexIntervalBytes && nanos >= lastIndexedNanos)) {
+            uint8_t* entry = indexStorage.get() + active * INDEX_BYTES_PER_BUFFER + indexUsed;
+            writeLe64(entry, nanos);
+            writeLe64(entry + 8, frameOffset);
+            indexUsed += INDEX_ENTRY_SIZE;
+
+            nextIndexNanos   = (nanos / config.indexIntervalNs + 1) * config.indexIntervalNs;
+            lastIndexedNanos = nanos;
+            lastIndexedFrame = frameOffset;
+        }
+    }
+
+    uint8_t* out = storage.get() + active * config.bufferSize + activeUsed;
+    writeLe64(out, nanos);
+    writeLe32(out + 8, static_cast<uint32_t>(size));
+    std::memcpy(out + FRAME_HEADER_SIZE, data, size);
+    activeUsed += needed;
+
+    frames.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(size, std::memory_order_relaxed);
+    return true;
+}
+
+void Recorder::record(const AsterixDatagram datagrams[], size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        record(datagrams[i].data, datagrams[i].size, datagrams[i].ts);
+    }
+}
+
+/**
+ * @brief Submits the active buffer and switches to a free one.
+ * @return false if no buffer is free and dropWhenBusy is set.
+ */
+bool Recorder::nextBuffer() {
+    reap(false);
+    if (freeBuffers.empty() && config.dropWhenBusy) return false;
+
+    // Waits for a completed write when every buffer is in flight
+    flush();
+    return true;
+}
+
+void Recorder::flush() {
+    if (fd < 0 || activeUsed == 0) return;
+
+    while (freeBuffers.empty()) reap(true);
+
+    // The index entries of the buffer's frames go with it
+    const detail::WriteRange data{storage.get() + active * config.bufferSize, activeUsed, fileOffset};
+    const detail::WriteRange entries{indexStorage.get() + active * INDEX_BYTES_PER_BUFFER, indexUsed, indexOffset};
+
+    const int err = backend->submit(active, data, entries);
+    if (err != 0) {
+        // Could not queue: write inline rather than lose the data
+        if (pwriteAll(fd, data.data, data.size, data.offset) != 0) {
+            writeErrors.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (entries.size > 0 && pwriteAll(indexFd, entries.data, entries.size, entries.offset) != 0) {
+            writeErrors.fetch_add(1, std::memory_order_relaxed);
+        }
+        freeBuffers.push_back(active);
+    }
+    writes.fetch_add(1, std::memory_order_relaxed);
+
+    fileOffset  += activeUsed;
+    indexOffset += indexUsed;
+    activeUsed   = 0;
+    indexUsed    = 0;
+    active       = freeBuffers.back();
+    freeBuffers.pop_back();
+}
+
+void Recorder::reap(bool wait) {
+    uint64_t errors = 0;
+    backend->reap(wait, freeBuffers, errors);
+    if (errors) writeErrors.fetch_add(errors, std::memory_order_relaxed);
+}
+
+int Recorder::close() {
+    if (fd < 0) return 0;
+
+    flush();
+    while (backend->inFlight() > 0) reap(true);
+    reap(false);
+    backend.reset();
+
+    int err = 0;
+    if (::fdatasync(fd) < 0) err = errno;
+    if (::close(fd) < 0 && err == 0) err = errno;
+    fd = -1;
+
+    if (indexFd >= 0) {
+        if (::close(indexFd) < 0 && err == 0) err = errno;
+        indexFd = -1;
+    }
+
+    if (err == 0 && writeErrors.load(std::memory_order_relaxed) > 0) err = EIO;
+    return err;
+}
+
+bool Recorder::usingIoUring() const noexcept {
+    return backend && backend->isIoUring();
+}
+
+RecorderStats Recorder::getStats() const noexcept {
+    return {
+        frames.load(std::memory_order_relaxed),
+        bytes.load(std::memory_order_relaxed),
+        dropped.load(std::memory_order_relaxed),
+        writes.load(std::memory_order_relaxed),
+        writeErrors.load(std::memory_order_relaxed)
+    };
+}
+
+} // namespace ReactorAsterix::Recording
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -0,0 +1,421 @@
+/*
+ * Copyright (C) 2026 Alfredo Tupone
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Interface
+#include <ReactorAsterix/recording/Replayer.h>
+
+// System headers
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iterator>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#ifdef REACTORASTERIX_HAVE_LIBURING
+#include <liburing.h>
+#endif
+
+// Library headers
+#include <ReactorAsterix/recording/RecordingFormat.h>
+
+namespace ReactorAsterix::Recording {
+
+namespace {
+    // Room in front of every read buffer for the incomplete frame of the previous chunk
+    constexpr size_t CARRY_SIZE = FRAME_HEADER_SIZE + MAX_FRAME_SIZE;
+
+    /**
+     * @brief Reads up to 'size' bytes at 'offset', stopping early only at EOF.
+     * @return The number of bytes read, or -errno.
+     */
+    ssize_t preadAll(int fd, uint8_t* data, size_t size, uint64_t offset) {
+        size_t total = 0;
+        while (total < size) {
+            const ssize_t n = ::pread(fd, data + total, size - total, static_cast<off_t>(offset + total));
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return -errno;
+            }
+            if (n == 0) break;
+            total += static_cast<size_t>(n);
+        }
+        return static_cast<ssize_t>(total);
+    }
+}
+
+namespace detail {
+
+/**
+ * @brief Reader with at most one read in flight.
+ */
+class ReadBackend {
+    public:
+        virtual ~ReadBackend() = default;
+
+        /**
+         * @brief Starts reading 'size' bytes at 'offset' into buffer 'index'.
+         * @return 0 on success, an errno value otherwise.
+         */
+        [[nodiscard]] virtual int start(size_t index, uint8_t* data, size_t size, uint64_t offset) = 0;
+
+        /**
+         * @brief Waits for the started read.
+         * @return The number of bytes read (short only at EOF), or -errno.
+         */
+        [[nodiscard]] virtual ssize_t wait() = 0;
+
+        [[nodiscard]] virtual bool isIoUring() const noexcept = 0;
+};
+
+} // namespace detail
+
+namespace {
+
+/**
+ * @brief Fallback: asks the kernel to read ahead, then reads synchronously.
+ */
+class ReadAheadBackend final : public detail::ReadBackend {
+    public:
+        explicit ReadAheadBackend(int _fd) : fd(_fd) {
+            posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+        }
+
+        int start(size_t, uint8_t* data, size_t size, uint64_t offset) override {
+            request = {data, size, offset};
+            // Starts the I/O in the background; pread() later finds the pages cached
+            posix_fadvise(fd, static_cast<off_t>(offset), static_cast<off_t>(size), POSIX_FADV_WILLNEED);
+            return 0;
+        }
+
+        ssize_t wait() override {
+            return preadAll(fd, request.data, request.size, request.offset);
+        }
+
+        bool isIoUring() const noexcept override { return false; }
+
+    private:
+        struct Request {
+            uint8_t* data{nullptr};
+            size_t size{0};
+            uint64_t offset{0};
+        };
+
+        int fd;
+        Request request{};
+};
+
+#ifdef REACTORASTERIX_HAVE_LIBURING
+/**
+ * @brief io_uring reader using the registered read buffers.
+ */
+class UringReadBackend final : public detail::ReadBackend {
+    public:
+        /**
+         * @return nullptr if the ring cannot be created (old kernel, seccomp).
+         */
+        static std::unique_ptr<UringReadBackend> create(int fd, uint8_t* storage,
+                                                        size_t bufferSize, size_t count) {
+            auto backend = std::unique_ptr<UringReadBackend>(new UringReadBackend(fd));
+            if (io_uring_queue_init(2, &backend->ring, 0) < 0) {
+                return nullptr;
+            }
+            backend->initialized = true;
+
+            std::vector<struct iovec> iovecs(count);
+            for (size_t i = 0; i < count; ++i) {
+                iovecs[i].iov_base = storage + i * bufferSize;
+                iovecs[i].iov_len  = bufferSize;
+            }
+            if (io_uring_register_buffers(&backend->ring, iovecs.data(),
+                                          static_cast<unsigned>(count)) < 0) {
+                return nullptr;
+            }
+            return backend;
+        }
+
+        ~UringReadBackend() override {
+            if (!initialized) return;
+            if (pending) (void)wait();
+            io_uring_queue_exit(&ring);
+        }
+
+        int start(size_t index, uint8_t* data, size_t size, uint64_t offset) override {
+            struct io_uring_sqe* sqe = io_uring_get_sqe(&ring);
+            if (!sqe) return EBUSY;
+
+            io_uring_prep_read_fixed(sqe, fd, data, static_cast<unsigned>(size),
+                                     offset, static_cast<int>(index));
+            request = {data, size, offset};
+
+            const int ret = io_uring_submit(&ring);
+            if (ret < 0) return -ret;
+
+            pending = true;
+            return 0;
+        }
+
+        ssize_t wait() override {
+            struct io_uring_cqe* cqe = nullptr;
+            int ret;
+            while ((ret = io_uring_wait_cqe(&ring, &cqe)) == -EINTR) {}
+            if (ret < 0) return ret;
+
+            const int res = cqe->res;
+            io_uring_cqe_seen(&ring, cqe);
+            pending = false;
+
+            if (res < 0) return res;
+
+            // A short read is not necessarily EOF: complete it synchronously
+            const auto got = static_cast<size_t>(res);
+            if (got > 0 && got < request.size) {
+                const ssize_t more = preadAll(fd, request.data + got, request.size - got, request.offset + got);
+                if (more < 0) return more;
+                return static_cast<ssize_t>(got) + more;
+            }
+            return res;
+        }
+
+        bool isIoUring() const noexcept override { return true; }
+
+    private:
+        struct Request {
+            uint8_t* data{nullptr};
+            size_t size{0};
+            uint64_t offset{0};
+        };
+
+        explicit UringReadBackend(int _fd) : fd(_fd) {}
+
+        int fd;
+        struct io_uring ring{};
+        bool initialized{false};
+        bool pending{false};
+        Request request{};
+};
+#endif
+
+} // namespace
+
+Replayer::Replayer(ReplayerConfig _config)
+    : config(std::move(_config)) {
+    // A frame never spans more than two reads
+    config.readSize = std::max(config.readSize, CARRY_SIZE);
+    storage = std::make_unique<uint8_t[]>(2 * (CARRY_SIZE + config.readSize));
+}
+
+Replayer::~Replayer() {
+    close();
+}
+
+int Replayer::open(const std::string& path) {
+    close();
+
+    const int newFd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (newFd < 0) return errno;
+
+    uint8_t header[FILE_HEADER_SIZE];
+    const ssize_t n = preadAll(newFd, header, sizeof(header), 0);
+    if (n != static_cast<ssize_t>(sizeof(header)) ||
+        std::memcmp(header, MAGIC, sizeof(MAGIC)) != 0 ||
+        readLe32(header + 8) != VERSION) {
+        ::close(newFd);
+        return n < 0 ? static_cast<int>(-n) : EBADMSG;
+    }
+
+#ifdef REACTORASTERIX_HAVE_LIBURING
+    if (config.useIoUring) {
+        backend = UringReadBackend::create(newFd, storage.get(), CARRY_SIZE + config.readSize, 2);
+    }
+#endif
+    if (!backend) {
+        backend = std::make_unique<ReadAheadBackend>(newFd);
+    }
+
+    fd = newFd;
+    loadIndex(path);
+    rewind();
+    return 0;
+}
+
+/**
+ * @brief Reads "<path>.idx" whole; a missing or foreign index is ignored and
+ * a partial last entry (interrupted recording) dropped.
+ */
+void Replayer::loadIndex(const std::string& path) {
+    timeIndex.clear();
+
+    const int indexFd = ::open(indexPath(path).c_str(), O_RDONLY | O_CLOEXEC);
+    if (indexFd < 0) return;
+
+    const off_t size = ::lseek(indexFd, 0, SEEK_END);
+    std::vector<uint8_t> raw(size > 0 ? static_cast<size_t>(size) : 0);
+    const ssize_t n = preadAll(indexFd, raw.data(), raw.size(), 0);
+    ::close(indexFd);
+
+    if (n < static_cast<ssize_t>(FILE_HEADER_SIZE) ||
+        std::memcmp(raw.data(), INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 ||
+        readLe32(raw.data() + 8) != VERSION) {
+        return;
+    }
+
+    const size_t count = (static_cast<size_t>(n) - FILE_HEADER_SIZE) / INDEX_ENTRY_SIZE;
+    timeIndex.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t* entry = raw.data() + FILE_HEADER_SIZE + i * INDEX_ENTRY_SIZE;
+        timeIndex.push_back({readLe64(entry), readLe64(entry + 8)});
+    }
+}
+
+void Replayer::seek(const struct timespec& from) {
+    startNanos = toNanos(from);
+    start      = FILE_HEADER_SIZE;
+
+    // Last indexed frame received before 'from': every later frame follows it
+    auto it = std::upper_bound(timeIndex.begin(), timeIndex.end(), startNanos,
+                               [](uint64_t nanos, const IndexEntry& entry) { return nanos < entry.nanos; });
+    if (it != timeIndex.begin()) {
+        start = std::prev(it)->offset;
+    }
+}
+
+void Replayer::setEndTime(const struct timespec& until) {
+    endNanos = toNanos(until);
+}
+
+void Replayer::rewind() noexcept {
+    start      = FILE_HEADER_SIZE;
+    startNanos = 0;
+    endNanos   = UINT64_MAX;
+}
+
+void Replayer::close() noexcept {
+    backend.reset();
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+int64_t Replayer::replay(AsterixPacketHandler& handler) {
+    return replayFrames([&handler](const uint8_t data[], size_t size, const struct timespec& ts) {
+        handler.handlePacket(data, size, ts);
+    });
+}
+
+int64_t Replayer::replay(const FrameCallback& callback) {
+    return replayFrames(callback);
+}
+
+/**
+ * @brief Walks the file chunk by chunk, reading the next chunk while the
+ * frames of the current one are delivered.
+ *
+ * A frame cut by the end of a chunk is copied in front of the next chunk,
+ * into the carry area that precedes every read buffer.
+ */
+template <typename Sink>
+int64_t Replayer::replayFrames(Sink&& sink) {
+    if (fd < 0) return -EBADF;
+
+    const size_t stride = CARRY_SIZE + config.readSize;
+    auto readArea = [&](size_t index) { return storage.get() + index * stride + CARRY_SIZE; };
+
+    stats = {};
+    uint64_t offset = start;
+    size_t current = 0;
+    size_t carry = 0;
+    bool pending = false;
+
+    auto finish = [&](int64_t result) {
+        if (pending) (void)backend->wait();
+        return result;
+    };
+
+    int err = backend->start(current, readArea(current), config.readSize, offset);
+    if (err != 0) return -err;
+    pending = true;
+
+    while (true) {
+        const ssize_t n = backend->wait();
+        pending = false;
+        if (n < 0) return n;
+
+        offset += static_cast<uint64_t>(n);
+        const size_t next = 1 - current;
+        if (n > 0) {
+            err = backend->start(next, readArea(next), config.readSize, offset);
+            if (err != 0) return -err;
+            pending = true;
+        }
+
+        const uint8_t* p = readArea(current) - carry;
+        size_t available = carry + static_cast<size_t>(n);
+
+        while (available >= FRAME_HEADER_SIZE) {
+            const size_t length = readLe32(p + 8);
+            if (length > MAX_FRAME_SIZE) [[unlikely]] {
+                return finish(-EBADMSG);
+            }
+            if (available < FRAME_HEADER_SIZE + length) break;
+
+            const uint64_t nanos = readLe64(p);
+            if (nanos >= endNanos) {
+                return finish(static_cast<int64_t>(stats.frames));
+            }
+            if (nanos >= startNanos) {
+                sink(p + FRAME_HEADER_SIZE, length, fromNanos(nanos));
+                ++stats.frames;
+                stats.bytes += length;
+            }
+
+            p         += FRAME_HEADER_SIZE + length;
+            available -= FRAME_HEADER_SIZE + length;
+        }
+
+        if (n == 0) {
+            stats.truncatedTail = available;
+            break;
+        }
+
+        // The next read targets the read area only, so the carry area is free
+        std::memcpy(readArea(next) - available, p, available);
+        carry   = available;
+        current = next;
+    }
+
+    return static_cast<int64_t>(stats.frames);
+}
+
+bool Replayer::usingIoUring() const noexcept {
+    return backend && backend->isIoUring();
+}
+
+} // namespace ReactorAsterix::Recording
+
+
+// Local Variables: ***
+// mode: C++ ***
+// tab-width: 4 ***
+// c-basic-offset: 4 ***
+// indent-tabs-mode: nil ***
+// End: ***
+// ex: shiftwidth=4 tabstop=4
@@ -1,6 +1,17 @@
 #include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ReactorAsterix/cat001/Asterix1CompactReport.h"
 #include "ReactorAsterix/cat001/Asterix1DataItemCollection.h"
+#include "ReactorAsterix/cat001/Asterix1Handler.h"
 #include "ReactorAsterix/cat001/Asterix1Report.h"
+#include "ReactorAsterix/cat001/AsyncAsterix1Listener.h"
+#include "ReactorAsterix/core/AsterixPacketHandler.h"
 
 using namespace ReactorAsterix;
 
@@ -18,3 +29,271 @@ TEST(Asterix1HandlerTest, DecodePolarCoordinates) {
     EXPECT_NEAR(report.range, 1852.0, 0.1);
     EXPECT_NEAR(report.azimuth, 1.570796, 0.0001);
 }
+
+namespace {
+    class RetainingListener : public IAsterix1Listener {
+        public:
+            void onReportDecoded(const Asterix1Report&) override {}
+            void onPooledReport(const PooledReport<Asterix1Report>& report) override {
+                kept.push_back(report);
+            }
+            std::vector<PooledReport<Asterix1Report>> kept;
+    };
+}
+
+TEST(Asterix1HandlerTest, PooledReportsCanBeRetained) {
+    Asterix1Handler handler(std::make_shared<SourceStateManager>());
+    handler.enableReportPool(4);
+
+    auto listener = std::make_shared<RetainingListener>();
+    handler.addListener(listener);
+
+    // FSPEC: I001/010, I001/020, I001/040
+    const std::string fspec("\xE0", 1);
+    const std::string payload("\x01\x02\x20\x00\x80\x40\x00", 7);
+
+    EXPECT_EQ(handler.processDataRecord(fspec, payload), payload.size());
+    EXPECT_EQ(handler.processDataRecord(fspec, payload), payload.size());
+
+    ASSERT_EQ(listener->kept.size(), 2u);
+    EXPECT_NE(listener->kept[0].get(), listener->kept[1].get());
+    EXPECT_EQ(listener->kept[1]->sourceIdentifier.sic, 2);
+    EXPECT_NEAR(listener->kept[1]->range, 1852.0, 0.1);
+}
+
+TEST(Asterix1HandlerTest, CachedPlansKeepReportingErrors) {
+    Asterix1Handler handler(std::make_shared<SourceStateManager>());
+    AsterixStats stats;
+    handler.setStats(stats);
+
+    auto listener = std::make_shared<RetainingListener>();
+    handler.addListener(listener);
+    handler.enableReportPool(4);
+
+    const std::string fspec("\xE0", 1);
+    const std::string payload("\x01\x02\x20\x00\x80\x40\x00", 7);
+
+    // The second record replays the plan of the first one
+    EXPECT_EQ(handler.processDataRecord(fspec, payload), payload.size());
+    EXPECT_EQ(handler.processDataRecord(fspec, payload), payload.size());
+
+    // Truncated inside I001/040 on the cached pattern
+    EXPECT_EQ(handler.processDataRecord(fspec, payload.substr(0, 5)), 0u);
+    EXPECT_EQ(stats.malformedRecords.load(), 1u);
+
+    // FSPEC left open: never cached, still rejected
+    EXPECT_EQ(handler.processDataRecord(std::string("\xE1", 1), payload), 0u);
+    EXPECT_EQ(stats.malformedRecords.load(), 2u);
+
+    // I001/010 missing: never cached, still rejected
+    const std::string noSource("\x60", 1);
+    EXPECT_EQ(handler.processDataRecord(noSource, payload.substr(2)), 0u);
+    EXPECT_EQ(handler.processDataRecord(noSource, payload.substr(2)), 0u);
+    EXPECT_EQ(stats.protocolViolations.load(), 2u);
+
+    EXPECT_EQ(handler.processDataRecord(fspec, payload), payload.size());
+    ASSERT_EQ(listener->kept.size(), 3u);
+    EXPECT_EQ(listener->kept[2]->sourceIdentifier.sic, 2);
+    EXPECT_NEAR(listener->kept[2]->azimuth, 1.570796, 0.0001);
+    EXPECT_EQ(stats.malformedRecords.load(), 2u);
+}
+
+TEST(Asterix1HandlerTest, StrictValidationLogsBrokenRules) {
+    AsterixPacketHandler packetHandler;
+    packetHandler.registerCategoryHandler(1, std::make_unique<Asterix1Handler>(std::make_shared<SourceStateManager>()));
+    packetHandler.enableValidation(true, 16);
+
+    // Sole primary plot with a reserved bit in I001/020, the spare bit of
+    // I001/070 and FL 2000 in I001/090; then a record without I001/020
+    const uint8_t block[] = {
+        0x01, 0x00, 0x16,
+        0xF8, 0x01, 0x02, 0x14, 0x00, 0x80, 0x40, 0x00, 0x10, 0x00, 0x1F, 0x40,
+        0xA0, 0x01, 0x02, 0x00, 0x80, 0x40, 0x00
+    };
+    packetHandler.handlePacket(block, sizeof(block), {});
+
+    struct Expected { uint64_t record; uint16_t offset; ValidationRule rule; uint8_t frn; };
+    const Expected expected[] = {
+        {0, 3,  ValidationRule::RESERVED_BITS, 2},
+        {0, 8,  ValidationRule::SPARE_BITS, 4},
+        {0, 10, ValidationRule::VALUE_OUT_OF_RANGE, 5},
+        {0, 0,  ValidationRule::CAT001_PRIMARY_WITH_SSR_DATA, 4},
+        {0, 0,  ValidationRule::CAT001_PRIMARY_WITH_SSR_DATA, 5},
+        {1, 0,  ValidationRule::MANDATORY_ITEM_MISSING, 2}
+    };
+
+    AsterixValidationLog* log = packetHandler.getValidationLog();
+    ASSERT_NE(log, nullptr);
+    for (const Expected& e : expected) {
+        ValidationError error;
+        ASSERT_TRUE(log->tryPop(error));
+        EXPECT_EQ(error.record, e.record);
+        EXPECT_EQ(error.offset, e.offset);
+        EXPECT_EQ(error.rule, e.rule);
+        EXPECT_EQ(error.category, 1);
+        EXPECT_EQ(error.frn, e.frn);
+    }
+    ValidationError none;
+    EXPECT_FALSE(log->tryPop(none));
+    EXPECT_EQ(log->records(), 2u);
+    EXPECT_EQ(log->dropped(), 0u);
+
+    // Invalid values are reported, not rejected
+    EXPECT_EQ(packetHandler.getCategorySnapshot(1).records, 1u);
+    EXPECT_EQ(packetHandler.getCategorySnapshot(1).protocolViolations, 1u);
+
+    // Turned off: no longer fed, still readable by its consumer
+    packetHandler.enableValidation(false);
+    EXPECT_EQ(packetHandler.getValidationLog(), nullptr);
+    packetHandler.handlePacket(block, sizeof(block), {});
+    EXPECT_EQ(log->records(), 2u);
+}
+
+TEST(Asterix1CompactReportTest, RoundTripsThroughRawUnits) {
+    Asterix1Report report;
+    I001_040_Handler polar;
+    I001_070_Handler mode3A;
+    I001_090_Handler modeC;
+
+    polar.decode(report, std::string("\x12\x34\xAB\xCD", 4));
+    mode3A.decode(report, std::string("\x47\x77", 2));
+    modeC.decode(report, std::string("\x3F\xF0", 2));
+    report.setSourceIdentifier(1, 2);
+    report.TOD = 123456;
+
+    const auto compact = Asterix1CompactReport::pack(report);
+    EXPECT_EQ(compact.range, 0x1234);
+    EXPECT_EQ(compact.azimuth, 0xABCD);
+    EXPECT_EQ(compact.modeC, -16);
+
+    Asterix1Report restored;
+    compact.unpack(restored);
+    EXPECT_DOUBLE_EQ(restored.range, report.range);
+    EXPECT_DOUBLE_EQ(restored.azimuth, report.azimuth);
+    ASSERT_TRUE(restored.mode3A);
+    EXPECT_EQ(restored.mode3A->code, 0x777);
+    EXPECT_TRUE(restored.mode3A->garbled);
+    ASSERT_TRUE(restored.ssrHeight);
+    EXPECT_DOUBLE_EQ(restored.ssrHeight->height, report.ssrHeight->height);
+    EXPECT_EQ(restored.TOD, 123456u);
+}
+
+namespace {
+    class CountingListener : public IAsterix1Listener {
+        public:
+            void onReportDecoded(const Asterix1Report& report) override {
+                // Reports must arrive in order
+                if (report.TOD == next) ++next;
+            }
+            std::atomic<uint32_t> next{0};
+    };
+}
+
+TEST(AsyncAsterix1ListenerTest, DeliversInOrderOnConsumerThread) {
+    auto target = std::make_shared<CountingListener>();
+    constexpr uint32_t COUNT = 10000;
+
+    {
+        AsyncAsterix1Listener async(target, 64, AsyncAsterix1Listener::OverflowPolicy::BLOCK);
+
+        Asterix1Report report;
+        for (uint32_t i = 0; i < COUNT; ++i) {
+            report.TOD = i;
+            async.onReportDecoded(report);
+        }
+        // The destructor drains the queue
+    }
+
+    EXPECT_EQ(target->next.load(), COUNT);
+}
+
+namespace {
+    class SlowListener : public IAsterix1Listener {
+        public:
+            void onReportDecoded(const Asterix1Report&) override {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+    };
+}
+
+TEST(LatencyHistogramsTest, SeparateDecodeFromListeners) {
+    AsterixPacketHandler packetHandler;
+    auto cat1 = std::make_unique<Asterix1Handler>(std::make_shared<SourceStateManager>());
+    auto listener = std::make_shared<SlowListener>();
+    cat1->addListener(listener);
+    packetHandler.registerCategoryHandler(1, std::move(cat1));
+
+    // Enabled after registration: existing handlers are linked too
+    packetHandler.enableLatencyHistograms();
+
+    // CAT001 block with two records (I001/010, I001/020, I001/040)
+    const uint8_t block[] = {
+        0x01, 0x00, 0x13,
+        0xE0, 0x01, 0x02, 0x20, 0x00, 0x80, 0x40, 0x00,
+        0xE0, 0x01, 0x02, 0x20, 0x00, 0x80, 0x40, 0x00
+    };
+
+    struct timespec ts{};
+    clock_gettime(CLOCK_REALTIME, &ts);
+    packetHandler.handlePacket(block, sizeof(block), ts);
+    packetHandler.handlePacket(block, sizeof(block), {});
+
+    const AsterixLatencyData latency = packetHandler.getLatencySnapshot();
+    EXPECT_EQ(latency.receive.count, 1u);   // The second packet has no timestamp
+    EXPECT_EQ(latency.decode.count, 2u);
+    EXPECT_EQ(latency.listener.count, 4u);
+    EXPECT_GE(latency.listener.percentile(0.5), 1900000u);
+    EXPECT_LT(latency.decode.maxNanos, latency.listener.percentile(0.5));
+
+    packetHandler.enableLatencyHistograms(false);
+    packetHandler.handlePacket(block, sizeof(block), ts);
+    EXPECT_EQ(packetHandler.getLatencySnapshot().listener.count, 0u);
+
+    // Kept while off, without counting the packet decoded meanwhile
+    packetHandler.enableLatencyHistograms();
+    EXPECT_EQ(packetHandler.getLatencySnapshot().listener.count, 4u);
+}
+
+TEST(BreakdownStatsTest, CountsPerCategoryAndSource) {
+    AsterixPacketHandler packetHandler;
+    packetHandler.enableSourceStats();
+    packetHandler.registerCategoryHandler(1, std::make_unique<Asterix1Handler>(std::make_shared<SourceStateManager>()));
+
+    // Two good records from 1/2, then one from 7/9 truncated inside I001/040
+    const uint8_t good[] = {
+        0x01, 0x00, 0x13,
+        0xE0, 0x01, 0x02, 0x20, 0x00, 0x80, 0x40, 0x00,
+        0xE0, 0x01, 0x02, 0x20, 0x00, 0x80, 0x40, 0x00
+    };
+    const uint8_t bad[] = {0x01, 0x00, 0x08, 0xE0, 0x07, 0x09, 0x20, 0x00};
+    const uint8_t unknown[] = {0x30, 0x00, 0x05, 0x00, 0x00};
+
+    packetHandler.handlePacket(good, sizeof(good), {});
+    packetHandler.handlePacket(bad, sizeof(bad), {});
+    packetHandler.handlePacket(unknown, sizeof(unknown), {});
+
+    const AsterixCategoryStatsData cat1 = packetHandler.getCategorySnapshot(1);
+    EXPECT_EQ(cat1.blocks, 2u);
+    EXPECT_EQ(cat1.records, 2u);
+    EXPECT_EQ(cat1.bytes, sizeof(good) + sizeof(bad));
+    EXPECT_EQ(cat1.malformedRecords, 1u);
+    EXPECT_EQ(cat1.recordParseErrors, 1u);
+
+    const auto categories = packetHandler.getCategoryBreakdown();
+    ASSERT_EQ(categories.size(), 2u);
+    EXPECT_EQ(categories[1].category, 48);
+    EXPECT_EQ(categories[1].unhandledBlocks, 1u);
+
+    const auto sources = packetHandler.getSourceBreakdown();
+    ASSERT_EQ(sources.size(), 2u);
+    EXPECT_EQ(sources[0].source.sac, 1);
+    EXPECT_EQ(sources[0].records, 2u);
+    EXPECT_EQ(sources[1].source.sic, 9);
+    EXPECT_EQ(sources[1].errors, 1u);
+
+    // Off hides the table without freeing it
+    packetHandler.enableSourceStats(false);
+    EXPECT_TRUE(packetHandler.getSourceBreakdown().empty());
+    packetHandler.enableSourceStats();
+    EXPECT_EQ(packetHandler.getSourceBreakdown().size(), 2u);
+}
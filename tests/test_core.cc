@@ -0,0 +1,327 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ReactorAsterix/core/AsterixCategoryHandler.h"
+#include "ReactorAsterix/core/AsterixDataItemHandlerExtendedLength.h"
+#include "ReactorAsterix/core/AsterixDataItemHandlerFixedLength.h"
+#include "ReactorAsterix/core/Fspec.h"
+#include "ReactorAsterix/core/LatencyHistogram.h"
+#include "ReactorAsterix/core/ReportPool.h"
+#include "ReactorAsterix/core/SourceStateManager.h"
+#include "ReactorAsterix/core/SpscRing.h"
+#include "ReactorAsterix/core/TimeReference.h"
+#include "ReactorAsterix/core/TruncatedTime.h"
+
+using namespace ReactorAsterix;
+
+TEST(TimeReferenceTest, ConvertsTimespecToTod) {
+    // 2 days + 01:00:00.5 after the epoch
+    struct timespec ts{2 * 86400 + 3600, 500000000};
+
+    EXPECT_EQ(TimeReference::todFromTimespec(ts), 3600u * 128 + 64);
+}
+
+TEST(TimeReferenceTest, ComputedOncePerPacket) {
+    TimeReference ref(TimeReference::Source::PacketTimestamp);
+
+    ref.beginPacket({10, 0});
+    EXPECT_EQ(ref.currentTod(), 10u * 128);
+
+    ref.beginPacket({20, 0});
+    EXPECT_EQ(ref.currentTod(), 20u * 128);
+}
+
+TEST(TimeReferenceTest, KeptWithinTick) {
+    TimeReference ref(TimeReference::Source::PacketTimestamp, std::chrono::seconds(1));
+
+    ref.beginPacket({10, 0});
+    EXPECT_EQ(ref.currentTod(), 10u * 128);
+
+    // Still inside the tick: cached value is reused
+    ref.beginPacket({10, 500000000});
+    EXPECT_EQ(ref.currentTod(), 10u * 128);
+
+    ref.beginPacket({11, 0});
+    EXPECT_EQ(ref.currentTod(), 11u * 128);
+}
+
+TEST(TimeReferenceTest, DroppedWhenTimestampsGoBack) {
+    TimeReference ref(TimeReference::Source::PacketTimestamp, std::chrono::seconds(1));
+
+    ref.beginPacket({50000, 0});
+    EXPECT_EQ(ref.currentTod(), 50000u * 128);
+
+    // Replay rewound
+    ref.beginPacket({40000, 0});
+    EXPECT_EQ(ref.currentTod(), 40000u * 128);
+}
+
+TEST(TimeReferenceTest, CoarseClockTickFollowsPacketTimestamps) {
+    TimeReference ref(TimeReference::Source::CoarseClock, std::chrono::milliseconds(20));
+
+    // Replayed, days old timestamps must not freeze the clock reading
+    ref.beginPacket({1000, 0});
+    const uint32_t first = ref.currentTod();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ref.beginPacket({1000, 10000000});
+    EXPECT_EQ(ref.currentTod(), first);
+
+    ref.beginPacket({1000, 30000000});
+    EXPECT_NE(ref.currentTod(), first);
+}
+
+TEST(SourceStateManagerTest, TracksScanFromNorthMarkers) {
+    SourceStateManager manager;
+    const SourceIdentifier si{1, 2};
+
+    EXPECT_FALSE(manager.estimateTimeAtAzimuth(si, 0.0, 1000));
+
+    // 4 s rotation, two north crossings
+    manager.updateNorthMarker(si, 1000);
+    manager.updateNorthMarker(si, 1000 + 4 * 128);
+
+    auto scan = manager.getScanState(si);
+    ASSERT_TRUE(scan);
+    EXPECT_EQ(scan->scanPeriod, 4u * 128);
+    EXPECT_EQ(scan->scanNumber, 2u);
+
+    // Half a turn after north
+    auto tod = manager.estimateTimeAtAzimuth(si, M_PI, 1000 + 4 * 128 + 2 * 128);
+    ASSERT_TRUE(tod);
+    EXPECT_EQ(*tod, 1000u + 4 * 128 + 2 * 128);
+}
+
+TEST(SourceStateManagerTest, EstimatesLateAzimuthsInCurrentRevolution) {
+    SourceStateManager manager;
+    const SourceIdentifier si{1, 2};
+
+    // 4 s rotation; CAT 002 also stores the marker as the source time
+    manager.updateNorthMarker(si, 1000);
+    manager.updateNorthMarker(si, 1512);
+    manager.updateSourceTime(si, 1512);
+
+    // 270 and 288 degrees, received right after the antenna got there
+    auto tod = manager.estimateTimeAtAzimuth(si, 1.5 * M_PI, 1512 + 384 + 2);
+    ASSERT_TRUE(tod);
+    EXPECT_EQ(*tod, 1512u + 384);
+    tod = manager.estimateTimeAtAzimuth(si, 1.6 * M_PI, 1512 + 409 + 2);
+    ASSERT_TRUE(tod);
+    EXPECT_EQ(*tod, 1512u + 409);
+
+    // Measured just before north, received just after: previous revolution
+    tod = manager.estimateTimeAtAzimuth(si, 1.99 * M_PI, 1512 + 4);
+    ASSERT_TRUE(tod);
+    EXPECT_EQ(*tod, 1512u - 3);
+}
+
+TEST(SourceStateManagerTest, LostMarkersAdvanceScanNumber) {
+    SourceStateManager manager;
+    const SourceIdentifier si{1, 2};
+
+    manager.updateAntennaPeriod(si, 4 * 128);
+    manager.updateNorthMarker(si, 0);
+    manager.updateNorthMarker(si, 3 * 4 * 128);
+
+    auto scan = manager.getScanState(si);
+    ASSERT_TRUE(scan);
+    EXPECT_EQ(scan->scanNumber, 4u);
+    EXPECT_EQ(scan->scanPeriod, 4u * 128);
+}
+
+TEST(SourceStateManagerTest, IgnoresDuplicateNorthMarkers) {
+    SourceStateManager manager;
+    const SourceIdentifier si{1, 2};
+
+    manager.updateNorthMarker(si, 1000);
+    manager.updateNorthMarker(si, 1000 + 4 * 128);
+
+    // Repeated, then one second late: neither is a revolution
+    manager.updateNorthMarker(si, 1000 + 4 * 128);
+    manager.updateNorthMarker(si, 1000 + 5 * 128);
+
+    auto scan = manager.getScanState(si);
+    ASSERT_TRUE(scan);
+    EXPECT_EQ(scan->scanNumber, 2u);
+    EXPECT_EQ(scan->scanPeriod, 4u * 128);
+    EXPECT_EQ(scan->lastNorthTod, 1000u + 4 * 128);
+
+    manager.updateNorthMarker(si, 1000 + 8 * 128);
+    EXPECT_EQ(manager.getScanState(si)->scanNumber, 3u);
+}
+
+TEST(TruncatedTimeTest, ExpandsToClosestWindow) {
+    constexpr uint32_t maxTod = 86400 * 128;
+
+    // Same window, previous and next window
+    EXPECT_EQ(TruncatedTime::expand(0x1234, 0x051000), 0x051234u);
+    EXPECT_EQ(TruncatedTime::expand(0xF000, 0x050100), 0x04F000u);
+    EXPECT_EQ(TruncatedTime::expand(0x0100, 0x05F000), 0x060100u);
+
+    // Across midnight, both ways
+    EXPECT_EQ(TruncatedTime::expand(static_cast<uint16_t>(maxTod - 10), 5), maxTod - 10);
+    EXPECT_EQ(TruncatedTime::expand(5, maxTod - 10), 5u);
+}
+
+TEST(FspecTest, LengthStopsAtFirstClosingByte) {
+    const uint8_t record[] = {0x81, 0x03, 0xE0, 0x01, 0x02};
+    EXPECT_EQ(Fspec::length(record, sizeof(record)), 3u);
+    EXPECT_EQ(Fspec::length(record, 2), 0u);
+
+    // FX set on all of the MAX_FSPEC_SIZE bytes
+    const std::vector<uint8_t> endless(16, 0x01);
+    EXPECT_EQ(Fspec::length(endless.data(), endless.size()), 0u);
+}
+
+TEST(FspecTest, PresenceMaskFollowsFrnOrder) {
+    // FRN 1, 7, FRN 64 and 65 (byte 9 straddles the two words), FRN 127 and 128
+    std::string fspec(19, '\x01');
+    fspec[0]  = '\x83';
+    fspec[9]  = '\xC1';
+    fspec[18] = '\xC0';
+
+    Fspec::FrnMask mask = Fspec::presence(fspec);
+    EXPECT_TRUE(mask.test(64));
+    EXPECT_TRUE(mask.test(65));
+
+    std::vector<unsigned> frns;
+    while (mask.any()) frns.push_back(mask.pop());
+    EXPECT_EQ(frns, (std::vector<unsigned>{1, 7, 64, 65, 127, 128}));
+
+    const Fspec::FrnMask head = Fspec::presence(fspec) & Fspec::FrnMask::below(65);
+    EXPECT_TRUE(head.test(64));
+    EXPECT_FALSE(head.test(65));
+    EXPECT_FALSE(Fspec::FrnMask::below(1).any());
+}
+
+namespace {
+    using ItemBytes = std::vector<std::string>;
+
+    class FixedItem final : public AsterixDataItemHandlerFixedLength<ItemBytes> {
+        public:
+            explicit FixedItem(uint8_t size) : AsterixDataItemHandlerFixedLength<ItemBytes>(size) {}
+            void decode(ItemBytes& items, std::string_view data) const override { items.emplace_back(data); }
+    };
+
+    class ExtendedItem final : public AsterixDataItemHandlerExtendedLength<ItemBytes> {
+        public:
+            ExtendedItem() : AsterixDataItemHandlerExtendedLength<ItemBytes>(1, 1) {}
+            void decode(ItemBytes& items, std::string_view data) const override { items.emplace_back(data); }
+    };
+
+    // FRN 1: 2 fixed bytes, FRN 2: 1 fixed byte; items can be replaced
+    class ReplaceableHandler final : public AsterixCategoryHandler<ItemBytes> {
+        public:
+            ReplaceableHandler() { registerHandlers(); }
+
+            void replace(std::unique_ptr<IAsterixDataItemHandler<ItemBytes>> item, uint8_t frn) {
+                addHandler(std::move(item), frn);
+            }
+
+            size_t processDataRecord(std::string_view fspec, std::string_view payload) override {
+                items.clear();
+                return _processDataRecordInternal(fspec, payload, items);
+            }
+
+            ItemBytes items;
+
+        protected:
+            void registerHandlers() override {
+                addHandler(std::make_unique<FixedItem>(2), 1);
+                addHandler(std::make_unique<FixedItem>(1), 2);
+            }
+    };
+}
+
+TEST(AsterixCategoryHandlerTest, ReplacedItemDropsItsFixedSize) {
+    ReplaceableHandler handler;
+    const std::string fspec("\xC0", 1);
+
+    // Caches the plan of the FSPEC with FRN 1 fixed
+    EXPECT_EQ(handler.processDataRecord(fspec, std::string("\x01\x02\x03", 3)), 3u);
+
+    // FRN 1 becomes variable: one byte here, FX clear
+    handler.replace(std::make_unique<ExtendedItem>(), 1);
+    EXPECT_EQ(handler.processDataRecord(fspec, std::string("\x04\x07", 2)), 2u);
+    EXPECT_EQ(handler.items, (ItemBytes{"\x04", "\x07"}));
+}
+
+TEST(ReportPoolTest, RecyclesReleasedReports) {
+    auto pool = ReportPool<SourceIdentifier>::create(2);
+
+    auto first = pool->acquire();
+    auto second = pool->acquire();
+    first->sac = 7;
+    SourceIdentifier* slot = first.get();
+
+    auto copy = first;
+    first.reset();
+    EXPECT_EQ(copy->sac, 7);
+
+    copy.reset();
+    auto again = pool->acquire();
+    EXPECT_EQ(again.get(), slot);
+    EXPECT_EQ(again->sac, 0);
+    EXPECT_EQ(pool->capacity(), 2u);
+}
+
+TEST(ReportPoolTest, HandleOutlivesOwner) {
+    auto pool = ReportPool<SourceIdentifier>::create(4);
+    auto handle = pool->acquire();
+    handle->sic = 3;
+
+    pool.reset();
+    EXPECT_EQ(handle->sic, 3);
+}
+
+TEST(SpscRingTest, DropOldestMakesRoom) {
+    SpscRing<int> ring(4);
+    ASSERT_EQ(ring.capacity(), 4u);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.tryPush(i));
+    }
+    EXPECT_FALSE(ring.tryPush(4));
+
+    EXPECT_TRUE(ring.dropOldest());
+    EXPECT_TRUE(ring.tryPush(4));
+
+    int value = -1;
+    for (int expected = 1; expected <= 4; ++expected) {
+        ASSERT_TRUE(ring.tryPop(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(ring.tryPop(value));
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(LatencyHistogramTest, BucketsBoundRelativeError) {
+    for (uint64_t v : {0ull, 15ull, 16ull, 17ull, 1000ull, 123456789ull, (1ull << 39) + 5}) {
+        const size_t i = LatencyBuckets::index(v);
+        ASSERT_LT(i, LatencyBuckets::COUNT);
+        EXPECT_GE(LatencyBuckets::upperBound(i), v);
+        EXPECT_LE(LatencyBuckets::upperBound(i) - v, v / 16);
+    }
+    EXPECT_EQ(LatencyBuckets::index(1ull << 50), LatencyBuckets::COUNT - 1);
+}
+
+TEST(LatencyHistogramTest, PercentilesOfMergedSnapshots) {
+    LatencyHistogram fast;
+    LatencyHistogram slow;
+    for (int i = 0; i < 99; ++i) fast.record(1000);
+    slow.record(1000000);
+
+    LatencySnapshot total = fast.snapshot();
+    total += slow.snapshot();
+
+    EXPECT_EQ(total.count, 100u);
+    EXPECT_EQ(total.maxNanos, 1000000u);
+    EXPECT_NEAR(static_cast<double>(total.percentile(0.5)), 1000.0, 1000.0 / 16);
+    EXPECT_NEAR(static_cast<double>(total.percentile(0.99)), 1000000.0, 1000000.0 / 16);
+    EXPECT_EQ(total.meanNanos(), (99u * 1000 + 1000000) / 100);
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "ReactorAsterix/cat001/Asterix1Report.h"
+#include "ReactorAsterix/cat002/Asterix2Report.h"
+#include "ReactorAsterix/export/ColumnarExporters.h"
+#include "ReactorAsterix/export/ColumnarReader.h"
+
+using namespace ReactorAsterix;
+using namespace ReactorAsterix::Export;
+
+namespace {
+    std::string tempPath(const char* name) {
+        return testing::TempDir() + name;
+    }
+}
+
+TEST(ColumnarExportTest, Cat001RowGroupsRoundTrip) {
+    const std::string path = tempPath("cat001.rax");
+
+    ColumnarWriterConfig config;
+    config.rowGroupRows = 100;
+    config.maxPendingGroups = 1;
+
+    Asterix1ColumnarExporter exporter(config);
+    ASSERT_EQ(exporter.open(path), 0);
+
+    constexpr size_t ROWS = 250;
+    for (size_t i = 0; i < ROWS; ++i) {
+        Asterix1Report report;
+        report.setSourceIdentifier(25, static_cast<uint8_t>(i % 3));
+        report.TOD = static_cast<uint32_t>(1000 + i);
+        report.hasPolarPosition = true;
+        report.range = static_cast<double>(i) * (1852.0 / 128.0);
+        report.setMode3A(static_cast<uint16_t>(i), true, false, false);
+        exporter.onReportDecoded(report);
+    }
+    ASSERT_EQ(exporter.close(), 0);
+
+    const ColumnarWriterStats stats = exporter.getWriter().getStats();
+    EXPECT_EQ(stats.rows, ROWS);
+    EXPECT_EQ(stats.rowGroups, 3u);
+    EXPECT_EQ(stats.droppedRows, 0u);
+
+    ColumnarReader reader;
+    ASSERT_EQ(reader.open(path), 0);
+    EXPECT_EQ(reader.schema(), Asterix1ColumnarExporter::SCHEMA);
+    ASSERT_EQ(reader.rowGroupCount(), 3u);
+    EXPECT_EQ(reader.rowCount(0), 100u);
+    EXPECT_EQ(reader.rowCount(2), 50u);
+
+    const int tod = reader.findColumn("tod");
+    const int range = reader.findColumn("range");
+    const int sic = reader.findColumn("sic");
+    ASSERT_GE(tod, 0);
+    ASSERT_GE(range, 0);
+    ASSERT_GE(sic, 0);
+    EXPECT_EQ(reader.findColumn("missing"), -1);
+
+    ColumnStats todStats;
+    ASSERT_EQ(reader.stats(1, static_cast<size_t>(tod), todStats), 0);
+    EXPECT_EQ(todStats.min, 1100.0);
+    EXPECT_EQ(todStats.max, 1199.0);
+
+    std::vector<uint16_t> ranges;
+    ASSERT_EQ(reader.readColumn(2, static_cast<size_t>(range), ranges), 0);
+    ASSERT_EQ(ranges.size(), 50u);
+    for (size_t i = 0; i < ranges.size(); ++i) EXPECT_EQ(ranges[i], 200 + i);
+
+    std::vector<uint8_t> sics;
+    ASSERT_EQ(reader.readColumn(0, static_cast<size_t>(sic), sics), 0);
+    ASSERT_EQ(sics.size(), 100u);
+    EXPECT_EQ(sics[4], 1);
+
+    // Typed reads check the column type
+    std::vector<uint32_t> wrong;
+    EXPECT_EQ(reader.readColumn(0, static_cast<size_t>(range), wrong), EINVAL);
+}
+
+TEST(ColumnarExportTest, Cat002Columns) {
+    const std::string path = tempPath("cat002.rax");
+
+    Asterix2ColumnarExporter exporter;
+    ASSERT_EQ(exporter.open(path), 0);
+
+    for (uint8_t i = 0; i < 8; ++i) {
+        Asterix2Report report;
+        report.setSourceIdentifier(1, 2);
+        report.setMessageType(2);
+        report.setSectorNumber(static_cast<uint8_t>(i * 32));
+        report.setAntennaSpeed(1.5f);
+        exporter.onReportDecoded(report);
+    }
+    ASSERT_EQ(exporter.close(), 0);
+
+    ColumnarReader reader;
+    ASSERT_EQ(reader.open(path), 0);
+    EXPECT_EQ(reader.schema(), Asterix2ColumnarExporter::SCHEMA);
+    ASSERT_EQ(reader.rowGroupCount(), 1u);
+
+    const int sector = reader.findColumn("sectorNumber");
+    ASSERT_GE(sector, 0);
+    ColumnStats sectorStats;
+    ASSERT_EQ(reader.stats(0, static_cast<size_t>(sector), sectorStats), 0);
+    EXPECT_EQ(sectorStats.min, 0.0);
+    EXPECT_EQ(sectorStats.max, 224.0);
+
+    std::vector<float> speeds;
+    ASSERT_EQ(reader.readColumn(0, static_cast<size_t>(reader.findColumn("antennaSpeed")), speeds), 0);
+    ASSERT_EQ(speeds.size(), 8u);
+    EXPECT_FLOAT_EQ(speeds[7], 1.5f);
+
+    std::vector<uint8_t> flags;
+    ASSERT_EQ(reader.readColumn(0, static_cast<size_t>(reader.findColumn("flags")), flags), 0);
+    EXPECT_EQ(flags[0], Asterix2ColumnRow::HAS_SECTOR);
+}
+
+TEST(ColumnarExportTest, RejectsUnfinishedFile) {
+    const std::string path = tempPath("unfinished.rax");
+
+    {
+        ColumnarWriter writer(7, sizeof(uint32_t), {{"value", ColumnType::U32, 0}});
+        ASSERT_EQ(writer.open(path), 0);
+        const uint32_t value = 42;
+        writer.append(&value);
+        ASSERT_EQ(writer.close(), 0);
+    }
+    {
+        ColumnarReader reader;
+        ASSERT_EQ(reader.open(path), 0);
+        std::vector<uint32_t> values;
+        ASSERT_EQ(reader.readColumn(0, 0, values), 0);
+        ASSERT_EQ(values.size(), 1u);
+        EXPECT_EQ(values[0], 42u);
+    }
+
+    // Cut the footer off
+    ASSERT_EQ(truncate(path.c_str(), 30), 0);
+    ColumnarReader reader;
+    EXPECT_EQ(reader.open(path), EBADMSG);
+}
+
+TEST(ColumnarExportTest, RejectsChunkSizeNotMatchingRows) {
+    const std::string path = tempPath("badchunk.rax");
+
+    {
+        ColumnarWriter writer(7, sizeof(uint32_t), {{"value", ColumnType::U32, 0}});
+        ASSERT_EQ(writer.open(path), 0);
+        const uint32_t value = 42;
+        writer.append(&value);
+        ASSERT_EQ(writer.close(), 0);
+    }
+
+    // Footer tail -> first footer entry -> row group -> size of its only chunk
+    std::FILE* file = std::fopen(path.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    uint64_t footerOffset = 0;
+    uint64_t groupOffset = 0;
+    ASSERT_EQ(std::fseek(file, -static_cast<long>(FOOTER_TAIL_SIZE), SEEK_END), 0);
+    ASSERT_EQ(std::fread(&footerOffset, sizeof(footerOffset), 1, file), 1u);
+    ASSERT_EQ(std::fseek(file, static_cast<long>(footerOffset), SEEK_SET), 0);
+    ASSERT_EQ(std::fread(&groupOffset, sizeof(groupOffset), 1, file), 1u);
+
+    const uint64_t hugeSize = uint64_t{1} << 40;
+    ASSERT_EQ(std::fseek(file, static_cast<long>(groupOffset + ROW_GROUP_HEADER_SIZE + 16), SEEK_SET), 0);
+    ASSERT_EQ(std::fwrite(&hugeSize, sizeof(hugeSize), 1, file), 1u);
+    std::fclose(file);
+
+    ColumnarReader reader;
+    ASSERT_EQ(reader.open(path), 0);
+    std::vector<uint32_t> values;
+    EXPECT_EQ(reader.readColumn(0, 0, values), EBADMSG);
+    ColumnStats stats;
+    EXPECT_EQ(reader.stats(0, 0, stats), EBADMSG);
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "ReactorAsterix/cat001/Asterix1Report.h"
+#include "ReactorAsterix/cat002/Asterix2Report.h"
+#include "ReactorAsterix/export/NdjsonSerializer.h"
+
+using namespace ReactorAsterix;
+using namespace ReactorAsterix::Export;
+
+TEST(NdjsonSerializerTest, Cat001Line) {
+    Asterix1Report report;
+    report.setSourceIdentifier(1, 2);
+    report.TOD = 1600;
+    report.setSSR_PSR(2);
+    report.hasPolarPosition = true;
+    report.range = 1234.5678;
+    report.azimuth = 0.7853981;
+    report.setMode3A(07777, true, false, true);
+
+    NdjsonSerializer serializer(1024);
+    ASSERT_TRUE(serializer.append(report));
+    EXPECT_EQ(std::string(serializer.data(), serializer.size()),
+              "{\"cat\":1,\"sac\":1,\"sic\":2,\"tod\":12.5,\"ssrpsr\":2,\"ds1ds2\":0,\"spi\":false,"
+              "\"range\":1234.57,\"azimuth\":0.785398,\"mode3A\":\"7777\",\"mode3AV\":true,"
+              "\"mode3AG\":false,\"mode3AL\":true}\n");
+}
+
+TEST(NdjsonSerializerTest, Cat002Line) {
+    Asterix2Report report;
+    report.setSourceIdentifier(3, 4);
+    report.TOD = 129;
+    report.setMessageType(2);
+    report.setSectorNumber(32);
+
+    // No I002/041: neither period nor speed
+    char line[NdjsonSerializer::MAX_LINE_SIZE];
+    size_t size = NdjsonSerializer::format(report, line, sizeof(line));
+    EXPECT_EQ(std::string(line, size),
+              "{\"cat\":2,\"sac\":3,\"sic\":4,\"tod\":1.0078125,\"type\":2,\"sector\":32}\n");
+
+    report.setAntennaSpeed(1.5f);
+    report.setAntennaPeriod(192);
+    size = NdjsonSerializer::format(report, line, sizeof(line));
+    EXPECT_EQ(std::string(line, size),
+              "{\"cat\":2,\"sac\":3,\"sic\":4,\"tod\":1.0078125,\"type\":2,\"sector\":32,"
+              "\"period\":192,\"speed\":1.5}\n");
+}
+
+TEST(NdjsonSerializerTest, FullBufferLeavesContentUnchanged) {
+    Asterix1Report report;
+    report.setSourceIdentifier(1, 2);
+    report.setSSRHeight(3048.0, true, false);
+
+    NdjsonSerializer serializer(NdjsonSerializer::MAX_LINE_SIZE);
+    size_t lines = 0;
+    while (serializer.append(report)) ++lines;
+
+    ASSERT_GT(lines, 0u);
+    const std::string content(serializer.data(), serializer.size());
+    EXPECT_EQ(content.size() % lines, 0u);
+    EXPECT_EQ(content.back(), '\n');
+    EXPECT_NE(content.find("\"height\":3048.00,\"heightV\":true"), std::string::npos);
+
+    serializer.clear();
+    EXPECT_TRUE(serializer.append(report));
+}
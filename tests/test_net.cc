@@ -0,0 +1,285 @@
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ReactorAsterix/core/AsterixPacketHandler.h"
+#include "ReactorAsterix/net/MetricsExporter.h"
+#include "ReactorAsterix/net/MulticastReceiver.h"
+#include "ReactorAsterix/net/ReusePortReceiverGroup.h"
+#include "ReactorAsterix/net/UdpReceiver.h"
+
+using namespace ReactorAsterix;
+
+namespace {
+    void sendTo(uint16_t port, const std::string& payload, int count,
+                const char* address = "127.0.0.1") {
+        const int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_GE(fd, 0);
+
+        struct sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port   = htons(port);
+        inet_pton(AF_INET, address, &addr.sin_addr);
+
+        for (int i = 0; i < count; ++i) {
+            ::sendto(fd, payload.data(), payload.size(), 0,
+                     reinterpret_cast<const struct sockaddr*>(&addr), sizeof(addr));
+        }
+        ::close(fd);
+    }
+
+    std::string httpGet(uint16_t port, const std::string& target) {
+        const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) return {};
+
+        struct sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port   = htons(port);
+        inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+
+        std::string response;
+        if (::connect(fd, reinterpret_cast<const struct sockaddr*>(&addr), sizeof(addr)) == 0) {
+            const std::string request = "GET " + target + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+            ::send(fd, request.data(), request.size(), 0);
+
+            char buf[4096];
+            ssize_t n;
+            while ((n = ::recv(fd, buf, sizeof(buf), 0)) > 0) response.append(buf, static_cast<size_t>(n));
+        }
+        ::close(fd);
+        return response;
+    }
+}
+
+TEST(UdpReceiverTest, ReceivesBatchOverLoopback) {
+    AsterixPacketHandler handler;
+
+    Net::UdpReceiverConfig config;
+    config.bindAddress = "127.0.0.1";
+    config.batchSize   = 16;
+
+    Net::UdpReceiver receiver(handler, config);
+    ASSERT_EQ(receiver.open(), 0);
+    ASSERT_NE(receiver.localPort(), 0);
+
+    // One CAT 001 block per datagram (no handler registered for it)
+    const std::string packet("\x01\x00\x06\x80\x01\x02", 6);
+    sendTo(receiver.localPort(), packet, 10);
+
+    int received = 0;
+    for (int attempt = 0; attempt < 10 && received < 10; ++attempt) {
+        const int n = receiver.poll();
+        ASSERT_GE(n, 0);
+        received += n;
+    }
+
+    EXPECT_EQ(received, 10);
+    EXPECT_EQ(handler.getStatsSnapshot().totalPackets, 10u);
+    EXPECT_EQ(handler.getStatsSnapshot().unhandledCategories, 10u);
+    EXPECT_LE(receiver.getStats().batches, 10u);
+}
+
+TEST(UdpReceiverTest, ReportsWhyRunStopped) {
+    AsterixPacketHandler handler;
+
+    // No timeout: run() could never see 'stop'
+    Net::UdpReceiverConfig config;
+    config.bindAddress   = "127.0.0.1";
+    config.pollTimeoutMs = 0;
+    Net::UdpReceiver blocking(handler, config);
+    EXPECT_EQ(blocking.open(), EINVAL);
+
+    // Never opened: the first poll() fails and run() gives up
+    config.pollTimeoutMs = 10;
+    Net::UdpReceiver receiver(handler, config);
+    std::atomic<bool> stop{false};
+    receiver.run(stop);
+    EXPECT_EQ(receiver.getStats().failed, 1u);
+
+    ASSERT_EQ(receiver.open(), 0);
+    EXPECT_EQ(receiver.getStats().failed, 0u);
+}
+
+TEST(ReusePortReceiverGroupTest, AggregatesAcrossInstances) {
+    Net::ReusePortGroupConfig config;
+    config.receiver.bindAddress   = "127.0.0.1";
+    config.receiver.pollTimeoutMs = 10;
+    config.instances = 2;
+
+    std::vector<size_t> setupCalls;
+    Net::ReusePortReceiverGroup group(config, [&](AsterixPacketHandler&, size_t index) {
+        setupCalls.push_back(index);
+    });
+    ASSERT_EQ(group.start(), 0);
+    ASSERT_EQ(group.size(), 2u);
+    EXPECT_EQ(setupCalls, (std::vector<size_t>{0, 1}));
+
+    const std::string packet("\x01\x00\x06\x80\x01\x02", 6);
+    sendTo(group.localPort(), packet, 20);
+
+    for (int attempt = 0; attempt < 200 && group.getStatsSnapshot().totalPackets < 20; ++attempt) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    EXPECT_EQ(group.getStatsSnapshot().totalPackets, 20u);
+    EXPECT_EQ(group.getReceiverStats().datagrams, 20u);
+    EXPECT_EQ(group.getReceiverStats().failed, 0u);
+    group.stop();
+    EXPECT_EQ(group.size(), 0u);
+}
+
+TEST(ReusePortReceiverGroupTest, RefusesToStartWithoutTimeout) {
+    Net::ReusePortGroupConfig config;
+    config.receiver.bindAddress   = "127.0.0.1";
+    config.receiver.pollTimeoutMs = 0;
+    config.instances  = 2;
+    config.pinThreads = false;
+
+    // stop() could never join the threads
+    Net::ReusePortReceiverGroup group(config, nullptr);
+    EXPECT_EQ(group.start(), EINVAL);
+    EXPECT_EQ(group.size(), 0u);
+}
+
+TEST(MulticastReceiverTest, FiltersCategoriesPerSubscription) {
+    AsterixPacketHandler all;
+    AsterixPacketHandler onlyCat2;
+
+    Net::MulticastReceiverConfig config;
+    config.pollTimeoutMs = 10;
+    Net::MulticastReceiver receiver(config);
+
+    // Unicast addresses are bound without a join, which keeps the test local
+    Net::MulticastSubscription subAll;
+    subAll.group   = "127.0.0.1";
+    subAll.handler = &all;
+    const int idAll = receiver.subscribe(subAll);
+    ASSERT_GE(idAll, 0);
+
+    Net::MulticastSubscription subCat2 = subAll;
+    subCat2.handler = &onlyCat2;
+    subCat2.categories.set(2);
+    const int idCat2 = receiver.subscribe(subCat2);
+    ASSERT_GE(idCat2, 0);
+
+    // CAT 001 block followed by a CAT 002 block
+    const std::string packet("\x01\x00\x05\x00\x00" "\x02\x00\x05\x00\x00", 10);
+    sendTo(receiver.localPort(static_cast<size_t>(idAll)), packet, 3);
+    sendTo(receiver.localPort(static_cast<size_t>(idCat2)), packet, 3);
+
+    int received = 0;
+    for (int attempt = 0; attempt < 20 && received < 6; ++attempt) {
+        received += receiver.poll();
+    }
+    ASSERT_EQ(received, 6);
+
+    EXPECT_EQ(receiver.getStats(static_cast<size_t>(idAll)).filteredBlocks, 0u);
+    EXPECT_EQ(all.getStatsSnapshot().unhandledCategories, 6u);
+
+    EXPECT_EQ(receiver.getStats(static_cast<size_t>(idCat2)).datagrams, 3u);
+    EXPECT_EQ(receiver.getStats(static_cast<size_t>(idCat2)).filteredBlocks, 3u);
+    EXPECT_EQ(receiver.getStats(static_cast<size_t>(idCat2)).filteredDatagrams, 0u);
+    EXPECT_EQ(onlyCat2.getStatsSnapshot().unhandledCategories, 3u);
+    EXPECT_EQ(onlyCat2.getStatsSnapshot().totalPackets, 3u);
+
+    // Selected blocks split by a skipped one still make a single datagram,
+    // and a datagram with nothing selected is counted by the receiver
+    const std::string split("\x02\x00\x05\x00\x00" "\x01\x00\x05\x00\x00" "\x02\x00\x05\x00\x00", 15);
+    const std::string skipped("\x01\x00\x05\x00\x00", 5);
+    sendTo(receiver.localPort(static_cast<size_t>(idCat2)), split, 1);
+    sendTo(receiver.localPort(static_cast<size_t>(idCat2)), skipped, 1);
+
+    received = 0;
+    for (int attempt = 0; attempt < 20 && received < 2; ++attempt) {
+        received += receiver.poll();
+    }
+    ASSERT_EQ(received, 2);
+
+    EXPECT_EQ(receiver.getStats(static_cast<size_t>(idCat2)).filteredBlocks, 5u);
+    EXPECT_EQ(receiver.getStats(static_cast<size_t>(idCat2)).filteredDatagrams, 1u);
+    EXPECT_EQ(onlyCat2.getStatsSnapshot().totalPackets, 4u);
+    EXPECT_EQ(onlyCat2.getStatsSnapshot().unhandledCategories, 5u);
+    EXPECT_EQ(onlyCat2.getStatsSnapshot().malformedBlocks, 0u);
+}
+
+TEST(MulticastReceiverTest, JoinsGroupOnLoopback) {
+    AsterixPacketHandler handler;
+    Net::MulticastReceiver receiver;
+
+    Net::MulticastSubscription sub;
+    sub.group            = "239.255.42.1";
+    sub.interfaceAddress = "127.0.0.1";
+    sub.handler          = &handler;
+    const int id = receiver.subscribe(sub);
+    if (id < 0) GTEST_SKIP() << "multicast unavailable: " << -id;
+
+    const int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+    ASSERT_GE(fd, 0);
+    struct in_addr iface{};
+    inet_pton(AF_INET, "127.0.0.1", &iface);
+    const unsigned char loop = 1;
+    if (setsockopt(fd, IPPROTO_IP, IP_MULTICAST_IF, &iface, sizeof(iface)) < 0 ||
+        setsockopt(fd, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop)) < 0) {
+        ::close(fd);
+        GTEST_SKIP() << "multicast loopback unavailable";
+    }
+
+    struct sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port   = htons(receiver.localPort(static_cast<size_t>(id)));
+    inet_pton(AF_INET, "239.255.42.1", &addr.sin_addr);
+    const char packet[] = "\x01\x00\x05\x00\x00";
+    const auto sent = ::sendto(fd, packet, 5, 0, reinterpret_cast<const struct sockaddr*>(&addr), sizeof(addr));
+    ::close(fd);
+    if (sent != 5) GTEST_SKIP() << "multicast send failed";
+
+    int received = 0;
+    for (int attempt = 0; attempt < 5 && received == 0; ++attempt) {
+        received += receiver.poll();
+    }
+    EXPECT_EQ(received, 1);
+    EXPECT_EQ(handler.getStatsSnapshot().totalPackets, 1u);
+}
+
+TEST(MetricsExporterTest, ServesOpenMetricsOverHttp) {
+    AsterixPacketHandler handler;
+    handler.enableLatencyHistograms();
+
+    // Unregistered CAT 048 block, then trailing garbage
+    const uint8_t packet[] = {0x30, 0x00, 0x05, 0x00, 0x00, 0xFF};
+    struct timespec ts{};
+    clock_gettime(CLOCK_REALTIME, &ts);
+    handler.handlePacket(packet, sizeof(packet), ts);
+
+    Net::MetricsExporterConfig config;
+    config.port = 0;
+    Net::MetricsExporter exporter(config);
+    exporter.addHandler(handler, "radar \"a\"");
+    ASSERT_EQ(exporter.start(), 0);
+    ASSERT_NE(exporter.localPort(), 0);
+
+    const std::string response = httpGet(exporter.localPort(), "/metrics?x=1");
+    EXPECT_EQ(response.rfind("HTTP/1.1 200 OK\r\n", 0), 0u);
+    EXPECT_NE(response.find("application/openmetrics-text"), std::string::npos);
+    EXPECT_NE(response.find("asterix_packets_total{handler=\"radar \\\"a\\\"\"} 1\n"), std::string::npos);
+    EXPECT_NE(response.find("asterix_trailing_bytes_total{handler=\"radar \\\"a\\\"\"} 1\n"), std::string::npos);
+    EXPECT_NE(response.find("asterix_category_unhandled_blocks_total{handler=\"radar \\\"a\\\"\",category=\"48\"} 1\n"),
+              std::string::npos);
+    EXPECT_NE(response.find("asterix_latency_seconds_count{handler=\"radar \\\"a\\\"\",stage=\"receive\"} 1\n"),
+              std::string::npos);
+    EXPECT_EQ(response.substr(response.size() - 6), "# EOF\n");
+    EXPECT_EQ(exporter.scrapes(), 1u);
+
+    EXPECT_EQ(httpGet(exporter.localPort(), "/other").rfind("HTTP/1.1 404", 0), 0u);
+
+    exporter.stop();
+}
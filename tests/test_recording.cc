@@ -0,0 +1,327 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "ReactorAsterix/core/AsterixPacketHandler.h"
+#include "ReactorAsterix/recording/AsterixFileReader.h"
+#include "ReactorAsterix/recording/Recorder.h"
+#include "ReactorAsterix/recording/RecordingFormat.h"
+#include "ReactorAsterix/recording/Replayer.h"
+
+using namespace ReactorAsterix;
+
+namespace {
+    std::string tempPath(const char* name) {
+        return testing::TempDir() + name;
+    }
+
+    // CAT 002 block of 'size' bytes (header included)
+    std::vector<uint8_t> makeBlock(size_t size) {
+        std::vector<uint8_t> block(size, 0x00);
+        block[0] = 0x02;
+        block[1] = static_cast<uint8_t>(size >> 8);
+        block[2] = static_cast<uint8_t>(size);
+        return block;
+    }
+
+    void writeFile(const std::string& path, const std::vector<uint8_t>& bytes) {
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    std::vector<uint8_t> makeDatagram(size_t index, size_t size) {
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; ++i) data[i] = static_cast<uint8_t>(index + i);
+        return data;
+    }
+}
+
+TEST(RecordingTest, RoundTripAcrossBufferAndChunkBoundaries) {
+    const std::string path = tempPath("roundtrip.rec");
+
+    // Small buffers and reads so that frames straddle both
+    Recording::RecorderConfig recorderConfig;
+    recorderConfig.bufferSize  = 1;
+    recorderConfig.bufferCount = 2;
+
+    constexpr size_t FRAMES = 600;
+    {
+        Recording::Recorder recorder(recorderConfig);
+        ASSERT_EQ(recorder.open(path), 0);
+        for (size_t i = 0; i < FRAMES; ++i) {
+            const auto data = makeDatagram(i, 500 + i % 700);
+            const struct timespec ts{static_cast<time_t>(1000 + i), static_cast<long>(i)};
+            ASSERT_TRUE(recorder.record(data.data(), data.size(), ts));
+        }
+        EXPECT_EQ(recorder.close(), 0);
+        EXPECT_EQ(recorder.getStats().frames, FRAMES);
+        EXPECT_GT(recorder.getStats().writes, 1u);
+    }
+
+    Recording::ReplayerConfig replayerConfig;
+    replayerConfig.readSize = 1;
+    Recording::Replayer replayer(replayerConfig);
+    ASSERT_EQ(replayer.open(path), 0);
+
+    size_t index = 0;
+    bool contentOk = true;
+    const int64_t replayed = replayer.replay([&](const uint8_t data[], size_t size, const struct timespec& ts) {
+        const auto expected = makeDatagram(index, 500 + index % 700);
+        contentOk = contentOk && size == expected.size() &&
+                    std::equal(expected.begin(), expected.end(), data) &&
+                    ts.tv_sec == static_cast<time_t>(1000 + index) &&
+                    ts.tv_nsec == static_cast<long>(index);
+        ++index;
+    });
+
+    EXPECT_EQ(replayed, static_cast<int64_t>(FRAMES));
+    EXPECT_TRUE(contentOk);
+    EXPECT_EQ(replayer.getStats().truncatedTail, 0u);
+    std::remove(path.c_str());
+}
+
+TEST(RecordingTest, ReplaysIntoPacketHandler) {
+    const std::string path = tempPath("handler.rec");
+    const uint8_t packet[] = {0x01, 0x00, 0x05, 0x00, 0x00};
+
+    {
+        Recording::Recorder recorder;
+        ASSERT_EQ(recorder.open(path), 0);
+        const AsterixDatagram batch[] = {
+            {packet, sizeof(packet), {1, 0}},
+            {packet, sizeof(packet), {2, 0}},
+            {packet, sizeof(packet), {3, 0}},
+        };
+        recorder.record(batch, 3);
+        EXPECT_EQ(recorder.fileSize(), Recording::FILE_HEADER_SIZE + 3 * (Recording::FRAME_HEADER_SIZE + 5));
+        EXPECT_EQ(recorder.close(), 0);
+    }
+
+    // Simulate a recording cut while writing a frame
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::app);
+        out.write("\x00\x00\x00", 3);
+    }
+
+    AsterixPacketHandler handler;
+    Recording::Replayer replayer;
+    ASSERT_EQ(replayer.open(path), 0);
+    EXPECT_EQ(replayer.replay(handler), 3);
+    EXPECT_EQ(replayer.getStats().truncatedTail, 3u);
+    EXPECT_EQ(handler.getStatsSnapshot().totalPackets, 3u);
+    std::remove(path.c_str());
+}
+
+TEST(RecordingTest, RejectsForeignFiles) {
+    const std::string path = tempPath("foreign.rec");
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "not a recording at all";
+    }
+
+    Recording::Replayer replayer;
+    EXPECT_EQ(replayer.open(path), EBADMSG);
+    std::remove(path.c_str());
+}
+
+TEST(RecordingTest, SeeksThroughTimeIndex) {
+    const std::string path = tempPath("indexed.rec");
+    const uint8_t packet[] = {0x01, 0x00, 0x05, 0x00, 0x00};
+
+    // 100 s of traffic, 10 datagrams per second
+    {
+        Recording::Recorder recorder;
+        ASSERT_EQ(recorder.open(path), 0);
+        for (long i = 0; i < 1000; ++i) {
+            const struct timespec ts{1'700'000'000 + i / 10, (i % 10) * 100'000'000};
+            recorder.record(packet, sizeof(packet), ts);
+        }
+        EXPECT_EQ(recorder.close(), 0);
+    }
+
+    Recording::Replayer replayer;
+    ASSERT_EQ(replayer.open(path), 0);
+    ASSERT_TRUE(replayer.hasIndex());
+
+    replayer.seek({1'700'000'050, 500'000'000});
+    replayer.setEndTime({1'700'000'055, 0});
+    EXPECT_EQ(replayer.startOffset(),
+              Recording::FILE_HEADER_SIZE + 500 * (Recording::FRAME_HEADER_SIZE + sizeof(packet)));
+
+    struct timespec first{};
+    int64_t replayed = replayer.replay([&](const uint8_t[], size_t, const struct timespec& ts) {
+        if (first.tv_sec == 0) first = ts;
+    });
+    EXPECT_EQ(replayed, 45);
+    EXPECT_EQ(first.tv_sec, 1'700'000'050);
+    EXPECT_EQ(first.tv_nsec, 500'000'000);
+
+    // Same selection without the index: a full scan
+    replayer.close();
+    std::remove(Recording::indexPath(path).c_str());
+    ASSERT_EQ(replayer.open(path), 0);
+    EXPECT_FALSE(replayer.hasIndex());
+    replayer.seek({1'700'000'050, 500'000'000});
+    replayer.setEndTime({1'700'000'055, 0});
+    EXPECT_EQ(replayer.startOffset(), Recording::FILE_HEADER_SIZE);
+    EXPECT_EQ(replayer.replay([](const uint8_t[], size_t, const struct timespec&) {}), 45);
+
+    std::remove(path.c_str());
+}
+
+TEST(RecordingTest, IndexStaysSortedAcrossClockStep) {
+    const std::string path = tempPath("clockstep.rec");
+    const uint8_t packet[] = {0x01, 0x00, 0x05, 0x00, 0x00};
+
+    // An entry every 4 frames by size; the clock steps back 10 s midway
+    Recording::RecorderConfig config;
+    config.indexIntervalBytes = 4 * (Recording::FRAME_HEADER_SIZE + sizeof(packet));
+    {
+        Recording::Recorder recorder(config);
+        ASSERT_EQ(recorder.open(path), 0);
+        for (long i = 0; i < 300; ++i) {
+            const long second = i < 100 ? 1000 + i / 10 : 1000 + i / 10 - 10;
+            recorder.record(packet, sizeof(packet), {second, (i % 10) * 100'000'000});
+        }
+        EXPECT_EQ(recorder.close(), 0);
+    }
+
+    std::ifstream in(Recording::indexPath(path), std::ios::binary);
+    std::vector<char> raw((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    ASSERT_GT(raw.size(), Recording::FILE_HEADER_SIZE);
+    ASSERT_EQ((raw.size() - Recording::FILE_HEADER_SIZE) % Recording::INDEX_ENTRY_SIZE, 0u);
+
+    uint64_t previous = 0;
+    size_t entries = 0;
+    for (size_t at = Recording::FILE_HEADER_SIZE; at < raw.size(); at += Recording::INDEX_ENTRY_SIZE) {
+        const uint64_t nanos = Recording::readLe64(reinterpret_cast<const uint8_t*>(raw.data() + at));
+        EXPECT_GE(nanos, previous) << "entry " << entries;
+        previous = nanos;
+        ++entries;
+    }
+    // Entries resume once the clock is back past the step
+    EXPECT_GT(previous, 1'015'000'000'000u);
+    EXPECT_GT(entries, 40u);
+
+    std::remove(Recording::indexPath(path).c_str());
+    std::remove(path.c_str());
+}
+
+namespace {
+    // 3000 records, enough to cross several reads
+    constexpr size_t FILE_RECORDS = 3000;
+
+    size_t blockSizeOf(size_t index) { return 5 + index % 200; }
+
+    std::vector<uint8_t> makeFinalFile() {
+        std::vector<uint8_t> file;
+        for (size_t i = 0; i < FILE_RECORDS; ++i) {
+            const auto block = makeBlock(blockSizeOf(i));
+            const size_t total = 8 + block.size() + 4;
+            const uint32_t time = static_cast<uint32_t>(i);  // 10 ms units
+            const uint8_t header[8] = {
+                static_cast<uint8_t>(total >> 8), static_cast<uint8_t>(total), 1, 2, 3,
+                static_cast<uint8_t>(time >> 16), static_cast<uint8_t>(time >> 8), static_cast<uint8_t>(time)
+            };
+            file.insert(file.end(), header, header + 8);
+            file.insert(file.end(), block.begin(), block.end());
+            file.insert(file.end(), 4, 0xA5);
+        }
+        return file;
+    }
+
+    std::vector<uint8_t> makeIossFile() {
+        std::vector<uint8_t> file;
+        for (size_t i = 0; i < FILE_RECORDS; ++i) {
+            const auto block = makeBlock(blockSizeOf(i));
+            const size_t total = 8 + block.size();
+            const auto time = static_cast<uint32_t>(i);
+            const uint8_t header[8] = {
+                static_cast<uint8_t>(total), static_cast<uint8_t>(total >> 8), 0, 1,
+                static_cast<uint8_t>(time), static_cast<uint8_t>(time >> 8),
+                static_cast<uint8_t>(time >> 16), static_cast<uint8_t>(time >> 24)
+            };
+            file.insert(file.end(), header, header + 8);
+            file.insert(file.end(), block.begin(), block.end());
+        }
+        return file;
+    }
+
+    std::vector<uint8_t> makeRawFile() {
+        std::vector<uint8_t> file;
+        for (size_t i = 0; i < FILE_RECORDS; ++i) {
+            const auto block = makeBlock(blockSizeOf(i));
+            file.insert(file.end(), block.begin(), block.end());
+        }
+        return file;
+    }
+
+    void expectRecords(Recording::AsterixFileReader& reader, bool timed) {
+        AsterixDatagram record{};
+        size_t index = 0;
+        bool ok = true;
+        while (reader.next(record) > 0) {
+            ok = ok && record.size == blockSizeOf(index) && record.data[0] == 0x02;
+            if (timed) {
+                ok = ok && record.ts.tv_sec == static_cast<time_t>(index / 100) &&
+                     record.ts.tv_nsec == static_cast<long>((index % 100) * 10'000'000);
+            }
+            ++index;
+        }
+        EXPECT_TRUE(ok);
+        EXPECT_EQ(index, FILE_RECORDS);
+        EXPECT_EQ(reader.getStats().truncatedTail, 0u);
+    }
+}
+
+TEST(AsterixFileReaderTest, DetectsAndStreamsFinal) {
+    const std::string path = tempPath("final.ast");
+    writeFile(path, makeFinalFile());
+
+    Recording::AsterixFileReader reader;
+    ASSERT_EQ(reader.open(path), 0);
+    EXPECT_EQ(reader.framing(), Recording::FileFraming::FINAL);
+    expectRecords(reader, true);
+    std::remove(path.c_str());
+}
+
+TEST(AsterixFileReaderTest, DetectsAndStreamsIoss) {
+    const std::string path = tempPath("ioss.ast");
+    writeFile(path, makeIossFile());
+
+    Recording::AsterixFileReaderConfig config;
+    config.useMmap = true;
+    Recording::AsterixFileReader reader(config);
+    ASSERT_EQ(reader.open(path), 0);
+    EXPECT_EQ(reader.framing(), Recording::FileFraming::IOSS);
+    expectRecords(reader, true);
+    std::remove(path.c_str());
+}
+
+TEST(AsterixFileReaderTest, DetectsAndStreamsRaw) {
+    const std::string path = tempPath("raw.ast");
+    auto file = makeRawFile();
+    file.push_back(0x02);  // A cut block at the end
+    writeFile(path, file);
+
+    Recording::AsterixFileReader reader;
+    ASSERT_EQ(reader.open(path), 0);
+    EXPECT_EQ(reader.framing(), Recording::FileFraming::RAW);
+
+    AsterixPacketHandler handler;
+    EXPECT_EQ(reader.feed(handler), static_cast<int64_t>(FILE_RECORDS));
+    EXPECT_EQ(reader.getStats().truncatedTail, 1u);
+    EXPECT_EQ(handler.getStatsSnapshot().unhandledCategories, FILE_RECORDS);
+    std::remove(path.c_str());
+}
+
+TEST(AsterixFileReaderTest, RejectsUnknownFraming) {
+    const std::string path = tempPath("unknown.ast");
+    writeFile(path, {0x00, 0x00, 0x01, 0x02, 0x03});
+
+    Recording::AsterixFileReader reader;
+    EXPECT_EQ(reader.open(path), EBADMSG);
+    std::remove(path.c_str());
+}